@@ -4,10 +4,11 @@
 
 // http://en.cppreference.com/w/cpp/algorithm/all_any_none_of
 
-#include <algorithm>  // all_of
+#include <algorithm>  // all_of, any_of, none_of
 #include <cassert>    // assert
 #include <functional> // function
 #include <iostream>   // cout, endl
+#include <iterator>   // begin, end
 #include <list>       // list
 
 #include "gtest/gtest.h"
@@ -38,6 +39,92 @@ TEST_P(AllOfListFixture, test_2) {
     const list<int> x = {3, 5, 7};
     ASSERT_TRUE(GetParam()(begin(x), end(x), [n] (int v) -> bool {return (v % n);}));}
 
+using AllOfArraySignature = function<bool (const int*, const int*, function<bool (int)>)>;
+
+struct AllOfArrayFixture : TestWithParam<AllOfArraySignature>
+    {};
+
+INSTANTIATE_TEST_CASE_P(
+    AllOfArrayInstantiation,
+    AllOfArrayFixture,
+    Values(
+                   all_of<const int*, function<bool (int)>>,
+                my_all_of<const int*, function<bool (int)>>,
+        my_all_of_chunked< 4, int, function<bool (int)>>,
+        my_all_of_chunked<64, int, function<bool (int)>>));
+
+TEST_P(AllOfArrayFixture, test_1) {
+    const int a[] = {3, 5, 7};
+    ASSERT_TRUE(GetParam()(begin(a), end(a), [] (int v) -> bool {return (v % 2);}));}
+
+TEST_P(AllOfArrayFixture, test_2) {
+    const int a[] = {3, 5, 7, 9, 11, 13, 15, 17, 19, 21};
+    ASSERT_TRUE(GetParam()(begin(a), end(a), [] (int v) -> bool {return (v % 2);}));}
+
+TEST_P(AllOfArrayFixture, test_3) {
+    const int a[] = {3, 5, 7, 9, 11, 13, 15, 17, 19, 22};
+    ASSERT_FALSE(GetParam()(begin(a), end(a), [] (int v) -> bool {return (v % 2);}));}
+
+TEST_P(AllOfArrayFixture, test_4) {
+    const int a[] = {3, 5, 8, 9, 11, 13, 15, 17, 19, 21};
+    ASSERT_FALSE(GetParam()(begin(a), end(a), [] (int v) -> bool {return (v % 2);}));}
+
+TEST_P(AllOfArrayFixture, test_5) {
+    const int a[] = {2};
+    ASSERT_TRUE(GetParam()(a, a, [] (int v) -> bool {return (v % 2);}));}
+
+using AnyOfArraySignature = function<bool (const int*, const int*, function<bool (int)>)>;
+
+struct AnyOfArrayFixture : TestWithParam<AnyOfArraySignature>
+    {};
+
+INSTANTIATE_TEST_CASE_P(
+    AnyOfArrayInstantiation,
+    AnyOfArrayFixture,
+    Values(
+                   any_of<const int*, function<bool (int)>>,
+                my_any_of<const int*, function<bool (int)>>,
+        my_any_of_chunked< 4, int, function<bool (int)>>,
+        my_any_of_chunked<64, int, function<bool (int)>>));
+
+TEST_P(AnyOfArrayFixture, test_1) {
+    const int a[] = {2, 4, 6};
+    ASSERT_FALSE(GetParam()(begin(a), end(a), [] (int v) -> bool {return (v % 2);}));}
+
+TEST_P(AnyOfArrayFixture, test_2) {
+    const int a[] = {2, 4, 6, 8, 10, 12, 14, 16, 18, 21};
+    ASSERT_TRUE(GetParam()(begin(a), end(a), [] (int v) -> bool {return (v % 2);}));}
+
+TEST_P(AnyOfArrayFixture, test_3) {
+    const int a[] = {2, 3, 6, 8, 10, 12, 14, 16, 18, 20};
+    ASSERT_TRUE(GetParam()(begin(a), end(a), [] (int v) -> bool {return (v % 2);}));}
+
+TEST_P(AnyOfArrayFixture, test_4) {
+    const int a[] = {3};
+    ASSERT_FALSE(GetParam()(a, a, [] (int v) -> bool {return (v % 2);}));}
+
+using NoneOfArraySignature = function<bool (const int*, const int*, function<bool (int)>)>;
+
+struct NoneOfArrayFixture : TestWithParam<NoneOfArraySignature>
+    {};
+
+INSTANTIATE_TEST_CASE_P(
+    NoneOfArrayInstantiation,
+    NoneOfArrayFixture,
+    Values(
+                   none_of<const int*, function<bool (int)>>,
+                my_none_of<const int*, function<bool (int)>>,
+        my_none_of_chunked< 4, int, function<bool (int)>>,
+        my_none_of_chunked<64, int, function<bool (int)>>));
+
+TEST_P(NoneOfArrayFixture, test_1) {
+    const int a[] = {2, 4, 6, 8, 10, 12, 14, 16, 18, 20};
+    ASSERT_TRUE(GetParam()(begin(a), end(a), [] (int v) -> bool {return (v % 2);}));}
+
+TEST_P(NoneOfArrayFixture, test_2) {
+    const int a[] = {2, 4, 6, 8, 10, 12, 14, 16, 18, 21};
+    ASSERT_FALSE(GetParam()(begin(a), end(a), [] (int v) -> bool {return (v % 2);}));}
+
 /*
 % AllOf
 Running main() from gtest_main.cc
@@ -5,12 +5,125 @@
 #ifndef AllOf_h
 #define AllOf_h
 
+#include <cstddef> // size_t
+
+#include "Dispatch.h"
+
 template <typename II, typename UP>
-bool my_all_of (II b, II e, UP f) {
+bool my_all_of_loop (II b, II e, UP f) {
     while (b != e) {
         if (!f(*b))
             return false;
         ++b;}
     return true;}
 
+template <typename II, typename UP>
+bool my_any_of_loop (II b, II e, UP f) {
+    while (b != e) {
+        if (f(*b))
+            return true;
+        ++b;}
+    return false;}
+
+// -------
+// chunked
+// -------
+
+/*
+the predicate is evaluated on blocks of N elements without branching,
+each block is reduced with a horizontal and/or,
+and the loop only exits at a block boundary
+the reduction is kept in an unsigned, a bool accumulator does not vectorize
+*/
+
+template <std::size_t N = 64, typename T, typename UP>
+bool my_all_of_chunked (const T* b, const T* e, UP f) {
+    static_assert(N > 0, "N must be positive");
+    while (static_cast<std::size_t>(e - b) >= N) {
+        unsigned r = 1;
+        for (std::size_t i = 0; i != N; ++i)
+            r &= (f(b[i]) ? 1u : 0u);
+        if (!r)
+            return false;
+        b += N;}
+    return my_all_of_loop(b, e, f);}
+
+template <std::size_t N = 64, typename T, typename UP>
+bool my_any_of_chunked (const T* b, const T* e, UP f) {
+    static_assert(N > 0, "N must be positive");
+    while (static_cast<std::size_t>(e - b) >= N) {
+        unsigned r = 0;
+        for (std::size_t i = 0; i != N; ++i)
+            r |= (f(b[i]) ? 1u : 0u);
+        if (r)
+            return true;
+        b += N;}
+    return my_any_of_loop(b, e, f);}
+
+template <std::size_t N = 64, typename T, typename UP>
+bool my_none_of_chunked (const T* b, const T* e, UP f) {
+    return !my_any_of_chunked<N>(b, e, f);}
+
+// -------
+// kernels
+// -------
+
+template <typename II, typename UP>
+bool my_all_of_kernel (II b, II e, UP f, scalar_kernel) {
+    return my_all_of_loop(b, e, f);}
+
+template <typename II, typename UP>
+bool my_all_of_kernel (II b, II e, UP f, chunked_kernel) {
+    return my_all_of_chunked(contiguous_iterator_traits<II>::pointer(b), contiguous_iterator_traits<II>::pointer(e), f);}
+
+// segmented range: each segment with the chunked kernel
+template <typename II, typename UP>
+bool my_all_of_kernel (II b, II e, UP f, segmented_kernel) {
+    typedef segmented_iterator_traits<II> traits;
+    typename traits::segment_iterator sb = traits::segment(b);
+    typename traits::segment_iterator se = traits::segment(e);
+    if (sb == se)
+        return my_all_of_chunked(traits::local(b), traits::local(e), f);
+    if (!my_all_of_chunked(traits::local(b), traits::end(sb), f))
+        return false;
+    for (++sb; sb != se; ++sb)
+        if (!my_all_of_chunked(traits::begin(sb), traits::end(sb), f))
+            return false;
+    return my_all_of_chunked(traits::begin(se), traits::local(e), f);}
+
+template <typename II, typename UP>
+bool my_any_of_kernel (II b, II e, UP f, scalar_kernel) {
+    return my_any_of_loop(b, e, f);}
+
+template <typename II, typename UP>
+bool my_any_of_kernel (II b, II e, UP f, chunked_kernel) {
+    return my_any_of_chunked(contiguous_iterator_traits<II>::pointer(b), contiguous_iterator_traits<II>::pointer(e), f);}
+
+// segmented range: each segment with the chunked kernel
+template <typename II, typename UP>
+bool my_any_of_kernel (II b, II e, UP f, segmented_kernel) {
+    typedef segmented_iterator_traits<II> traits;
+    typename traits::segment_iterator sb = traits::segment(b);
+    typename traits::segment_iterator se = traits::segment(e);
+    if (sb == se)
+        return my_any_of_chunked(traits::local(b), traits::local(e), f);
+    if (my_any_of_chunked(traits::local(b), traits::end(sb), f))
+        return true;
+    for (++sb; sb != se; ++sb)
+        if (my_any_of_chunked(traits::begin(sb), traits::end(sb), f))
+            return true;
+    return my_any_of_chunked(traits::begin(se), traits::local(e), f);}
+
+template <typename II, typename UP>
+bool my_all_of (II b, II e, UP f) {
+    return my_all_of_kernel(b, e, f, typename all_of_kernel<II>::type());}
+
+template <typename II, typename UP>
+bool my_any_of (II b, II e, UP f) {
+    return my_any_of_kernel(b, e, f, typename all_of_kernel<II>::type());}
+
+template <typename II, typename UP>
+bool my_none_of (II b, II e, UP f) {
+    return !my_any_of(b, e, f);}
+
 #endif // AllOf_h
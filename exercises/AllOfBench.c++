@@ -0,0 +1,48 @@
+// --------------
+// AllOfBench.c++
+// --------------
+
+#include <algorithm> // all_of, any_of, none_of
+#include <cstdio>    // printf
+#include <cstdlib>   // atoi
+#include <vector>    // vector
+
+#include "AllOf.h"
+#include "Bench.h"
+
+// the predicate is never decided early, so every algorithm reads all n values
+template <typename F1, typename F2, typename F3>
+void table (const char* s1, const char* s2, const char* s3, int m, F1 f1, F2 f2, F3 f3) {
+    using namespace std;
+    printf("%10s %12s %12s %12s\n", "n", s1, s2, s3);
+    for (int n = 1 << 10; n <= m; n <<= 2) {
+        const vector<int> x(n, 1);
+        const int* const b = x.data();
+        const int* const e = b + n;
+        const int        r = (1 << 26) / n + 1;
+        const double t1 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(f1(b, e));});
+        const double t2 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(f2(b, e));});
+        const double t3 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(f3(b, e));});
+        printf("%10d %10.3fns %10.3fns %10.3fns\n", n, t1 * 1e9 / r / n, t2 * 1e9 / r / n, t3 * 1e9 / r / n);}
+    printf("\n");}
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const int m = (argc > 1) ? atoi(argv[1]) : (1 << 24);
+    const auto f = [] (int v) -> bool {return v >= 0;};
+    const auto g = [] (int v) -> bool {return v <  0;};
+    typedef const int* P;
+
+    table("all_of",  "loop", "my_all_of",  m,
+        [&] (P b, P e) {return            all_of(b, e, f);},
+        [&] (P b, P e) {return    my_all_of_loop(b, e, f);},
+        [&] (P b, P e) {return         my_all_of(b, e, f);});
+    table("any_of",  "loop", "my_any_of",  m,
+        [&] (P b, P e) {return            any_of(b, e, g);},
+        [&] (P b, P e) {return    my_any_of_loop(b, e, g);},
+        [&] (P b, P e) {return         my_any_of(b, e, g);});
+    table("none_of", "loop", "my_none_of", m,
+        [&] (P b, P e) {return           none_of(b, e, g);},
+        [&] (P b, P e) {return   !my_any_of_loop(b, e, g);},
+        [&] (P b, P e) {return        my_none_of(b, e, g);});
+    return 0;}
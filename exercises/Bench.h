@@ -0,0 +1,113 @@
+// -------
+// Bench.h
+// -------
+
+#ifndef Bench_h
+#define Bench_h
+
+#include <algorithm> // max_element, min, min_element, nth_element
+#include <chrono>    // duration, steady_clock
+#include <cmath>     // abs
+#include <cstddef>   // size_t
+#include <vector>    // vector
+
+// ---------------
+// do_not_optimize
+// ---------------
+
+/*
+keeps the compiler from discarding a result that is otherwise unused
+*/
+
+template <typename T>
+void do_not_optimize (const T& v) {
+    asm volatile("" : : "r,m"(v) : "memory");}
+
+// -----
+// bench
+// -----
+
+/*
+runs f n times and returns the fastest run in seconds
+*/
+
+template <typename F>
+double bench (F f, int n = 5) {
+    double t = 1e300;
+    for (int i = 0; i != n; ++i) {
+        const std::chrono::steady_clock::time_point b = std::chrono::steady_clock::now();
+        f();
+        const std::chrono::steady_clock::time_point e = std::chrono::steady_clock::now();
+        t = std::min(t, std::chrono::duration<double>(e - b).count());}
+    return t;}
+
+// ------
+// median
+// ------
+
+/*
+the middle value, the mean of the two middle values when the size is even
+takes x by value, nth_element reorders it
+*/
+
+inline double median (std::vector<double> x) {
+    if (x.empty())
+        return 0;
+    const std::size_t h = x.size() / 2;
+    std::nth_element(x.begin(), x.begin() + h, x.end());
+    const double m = x[h];
+    if (x.size() % 2 != 0)
+        return m;
+    return (*std::max_element(x.begin(), x.begin() + h) + m) / 2;}
+
+// -----
+// Stats
+// -----
+
+/*
+min    : the fastest run, the best estimate of the cost without interference
+median : the typical run
+mad    : the median absolute deviation from the median, the spread,
+         unlike the standard deviation one slow run does not inflate it
+*/
+
+struct Stats {
+    double min;
+    double median;
+    double mad;
+    int    n;};
+
+inline Stats stats (const std::vector<double>& x) {
+    Stats s = {0, 0, 0, static_cast<int>(x.size())};
+    if (x.empty())
+        return s;
+    s.min    = *std::min_element(x.begin(), x.end());
+    s.median = median(x);
+    std::vector<double> d(x.size());
+    for (std::size_t i = 0; i != x.size(); ++i)
+        d[i] = std::abs(x[i] - s.median);
+    s.mad = median(d);
+    return s;}
+
+// -------
+// measure
+// -------
+
+/*
+runs f w times untimed, to fault in the memory and warm the caches and the branch predictors,
+then n times timed, and returns the statistics of the timed runs in seconds
+*/
+
+template <typename F>
+Stats measure (F f, int n = 11, int w = 2) {
+    for (int i = 0; i != w; ++i)
+        f();
+    std::vector<double> x(n);
+    for (int i = 0; i != n; ++i) {
+        const std::chrono::steady_clock::time_point b = std::chrono::steady_clock::now();
+        f();
+        const std::chrono::steady_clock::time_point e = std::chrono::steady_clock::now();
+        x[i] = std::chrono::duration<double>(e - b).count();}
+    return stats(x);}
+
+#endif // Bench_h
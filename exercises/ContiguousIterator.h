@@ -0,0 +1,58 @@
+// --------------------
+// ContiguousIterator.h
+// --------------------
+
+#ifndef ContiguousIterator_h
+#define ContiguousIterator_h
+
+#include <iterator>    // __normal_iterator
+#include <type_traits> // integral_constant, is_pointer
+
+/*
+a contiguous iterator walks elements that are adjacent in memory,
+a pointer, or a vector or string iterator, which wraps one
+the traits expose the pointer, so that an algorithm can run a kernel
+on raw memory that the compiler is free to vectorize
+
+pointer(i) : the address of the element that i refers to, valid at end too
+*/
+
+// --------------------------
+// contiguous_iterator_traits
+// --------------------------
+
+template <typename I>
+struct contiguous_iterator_traits {
+    static const bool is_contiguous = false;};
+
+template <typename T>
+struct contiguous_iterator_traits<T*> {
+    typedef T* pointer_type;
+
+    static const bool is_contiguous = true;
+
+    static pointer_type pointer (T* i) {
+        return i;}};
+
+#ifdef __GLIBCXX__
+// vector<T>, except vector<bool>, and basic_string
+template <typename P, typename C>
+struct contiguous_iterator_traits<__gnu_cxx::__normal_iterator<P, C>> {
+    typedef P pointer_type;
+
+    static const bool is_contiguous = std::is_pointer<P>::value;
+
+    static pointer_type pointer (const __gnu_cxx::__normal_iterator<P, C>& i) {
+        return i.base();}};
+#endif
+
+// ----------------------
+// is_contiguous_iterator
+// ----------------------
+
+template <typename I>
+struct is_contiguous_iterator :
+        std::integral_constant<bool, contiguous_iterator_traits<I>::is_contiguous>
+    {};
+
+#endif // ContiguousIterator_h
@@ -6,6 +6,7 @@
 
 #include <algorithm>  // copy, equal
 #include <cassert>    // assert
+#include <deque>      // deque
 #include <functional> // function
 #include <iostream>   // cout, endl
 #include <list>       // list
@@ -14,6 +15,7 @@
 #include "gtest/gtest.h"
 
 #include "Copy.h"
+#include "Range.h"
 
 using namespace std;
 using namespace testing;
@@ -44,6 +46,113 @@ TEST_P(CopyListFixture, test_2) {
     ASSERT_EQ(p, begin(y) + 5);
     ASSERT_TRUE(equal(begin(y), end(y), begin({0, 2, 3, 4, 5, 0})));}
 
+using CopyDequeSignature = function<vector<int>::iterator (deque<int>::const_iterator, deque<int>::const_iterator, vector<int>::iterator)>;
+
+struct CopyDequeFixture : TestWithParam<CopyDequeSignature>
+    {};
+
+INSTANTIATE_TEST_CASE_P(
+    CopyDequeInstantiation,
+    CopyDequeFixture,
+    Values(
+           copy<deque<int>::const_iterator, vector<int>::iterator>,
+        my_copy<deque<int>::const_iterator, vector<int>::iterator>));
+
+TEST_P(CopyDequeFixture, test_1) {
+    const deque<int>  x = {2, 3, 4};
+          vector<int> y(5);
+    vector<int>::iterator p = GetParam()(begin(x), end(x), begin(y) + 1);
+    ASSERT_EQ(p, begin(y) + 4);
+    ASSERT_TRUE(equal(begin(y), end(y), begin({0, 2, 3, 4, 0})));}
+
+TEST_P(CopyDequeFixture, test_2) {
+    deque<int> x;
+    for (int i = 0; i != 1000; ++i)
+        x.push_front(i);
+    vector<int> y(1000);
+    vector<int>::iterator p = GetParam()(begin(x) + 10, end(x) - 10, begin(y) + 10);
+    ASSERT_EQ(p, end(y) - 10);
+    ASSERT_TRUE(equal(begin(x) + 10, end(x) - 10, begin(y) + 10));
+    ASSERT_EQ(0, y[9]);
+    ASSERT_EQ(0, y[990]);}
+
+using CopyToDequeSignature = function<deque<int>::iterator (vector<int>::const_iterator, vector<int>::const_iterator, deque<int>::iterator)>;
+
+struct CopyToDequeFixture : TestWithParam<CopyToDequeSignature>
+    {};
+
+INSTANTIATE_TEST_CASE_P(
+    CopyToDequeInstantiation,
+    CopyToDequeFixture,
+    Values(
+           copy<vector<int>::const_iterator, deque<int>::iterator>,
+        my_copy<vector<int>::const_iterator, deque<int>::iterator>));
+
+TEST_P(CopyToDequeFixture, test_1) {
+    const vector<int> x = {2, 3, 4};
+          deque<int>  y(5);
+    deque<int>::iterator p = GetParam()(begin(x), end(x), begin(y) + 1);
+    ASSERT_EQ(p, begin(y) + 4);
+    ASSERT_TRUE(equal(begin(y), end(y), begin({0, 2, 3, 4, 0})));}
+
+TEST_P(CopyToDequeFixture, test_2) {
+    vector<int> x(1000);
+    for (int i = 0; i != 1000; ++i)
+        x[i] = i;
+    deque<int> y(1100);
+    deque<int>::iterator p = GetParam()(begin(x), end(x), begin(y) + 100);
+    ASSERT_EQ(p, end(y));
+    ASSERT_TRUE(equal(begin(x), end(x), begin(y) + 100));
+    ASSERT_EQ(0, y[99]);}
+
+TEST_P(CopyToDequeFixture, test_3) {
+    const vector<int> x(128, 2);
+          deque<int>  y(256);
+    deque<int>::iterator p = GetParam()(begin(x), end(x), begin(y));
+    ASSERT_EQ(p, begin(y) + 128);
+    ASSERT_EQ(2, *(p - 1));
+    ASSERT_EQ(0, *p);}
+
+using CopyRangeSignature = function<vector<int>::iterator (::Range<int>::iterator, ::Range<int>::iterator, vector<int>::iterator)>;
+
+struct CopyRangeFixture : TestWithParam<CopyRangeSignature>
+    {};
+
+INSTANTIATE_TEST_CASE_P(
+    CopyRangeInstantiation,
+    CopyRangeFixture,
+    Values(
+           copy<::Range<int>::iterator, vector<int>::iterator>,
+        my_copy<::Range<int>::iterator, vector<int>::iterator>));
+
+TEST_P(CopyRangeFixture, test_1) {
+    const ::Range<int> x(2, 5);
+          vector<int>  y(5);
+    vector<int>::iterator p = GetParam()(begin(x), end(x), begin(y) + 1);
+    ASSERT_EQ(p, begin(y) + 4);
+    ASSERT_TRUE(equal(begin(y), end(y), begin({0, 2, 3, 4, 0})));}
+
+TEST_P(CopyRangeFixture, test_2) {
+    const ::Range<int> x(-500, 503);
+          vector<int>  y(1003);
+    vector<int>::iterator p = GetParam()(begin(x), end(x), begin(y));
+    ASSERT_EQ(p, end(y));
+    ASSERT_TRUE(equal(begin(x), end(x), begin(y)));}
+
+TEST_P(CopyRangeFixture, test_3) {
+    const ::Range<int> x(7, 7);
+          vector<int>  y(1, 1);
+    vector<int>::iterator p = GetParam()(begin(x), end(x), begin(y));
+    ASSERT_EQ(p, begin(y));
+    ASSERT_EQ(1, y[0]);}
+
+TEST(CopyRangeToDequeFixture, test_1) {
+    const ::Range<int> x(0, 1000);
+          deque<int>   y(1100);
+    deque<int>::iterator p = my_copy(begin(x), end(x), begin(y) + 100);
+    ASSERT_EQ(p, end(y));
+    ASSERT_TRUE(equal(begin(x), end(x), begin(y) + 100));}
+
 /*
 % Copy
 Running main() from gtest_main.cc
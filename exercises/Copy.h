@@ -5,12 +5,91 @@
 #ifndef Copy_h
 #define Copy_h
 
+#include <algorithm>  // min
+#include <cstring>    // memmove
+#include <functional> // less
+#include <iterator>   // iterator_traits
+
+#include "Dispatch.h"
+
 template <typename II, typename OI>
-OI my_copy (II b, II e, OI x) {
+OI my_copy (II b, II e, OI x);
+
+template <typename II, typename OI>
+OI my_copy_loop (II b, II e, OI x) {
     while (b != e) {
         *x = *b;
         ++b;
         ++x;}
     return x;}
 
+template <typename II, typename OI>
+OI my_copy_kernel (II b, II e, OI x, scalar_kernel) {
+    return my_copy_loop(b, e, x);}
+
+template <typename II, typename OI>
+OI my_copy_kernel (II b, II e, OI x, contiguous_kernel) {
+    const typename std::iterator_traits<II>::difference_type n = e - b;
+    my_copy_loop(contiguous_iterator_traits<II>::pointer(b), contiguous_iterator_traits<II>::pointer(e), contiguous_iterator_traits<OI>::pointer(x));
+    return x + n;}
+
+// split across threads only when the ranges do not overlap
+template <typename II, typename OI>
+OI my_copy_kernel (II b, II e, OI x, memmove_kernel) {
+    typedef typename iterator_value<II>::type value_type;
+    const std::size_t n = e - b;
+    if (n == 0)
+        return x;
+    const char*       p = reinterpret_cast<const char*>(contiguous_iterator_traits<II>::pointer(b));
+    char*             q = reinterpret_cast<char*>      (contiguous_iterator_traits<OI>::pointer(x));
+    const std::size_t s = n * sizeof(value_type);
+    const unsigned    t = (std::less<const char*>()(q + s, p + 1) || std::less<const char*>()(p + s, q + 1)) ? dispatch_threads(s) : 1;
+    parallel_blocks(s, t, [p, q] (std::size_t i, std::size_t j) {
+        std::memmove(q + i, p + i, j - i);});
+    return x + n;}
+
+// segmented input: copy each segment with a contiguous kernel
+template <typename II, typename OI>
+OI my_copy_kernel (II b, II e, OI x, segmented_kernel) {
+    typedef segmented_iterator_traits<II> traits;
+    typename traits::segment_iterator sb = traits::segment(b);
+    typename traits::segment_iterator se = traits::segment(e);
+    if (sb == se)
+        return my_copy(traits::local(b), traits::local(e), x);
+    x = my_copy(traits::local(b), traits::end(sb), x);
+    for (++sb; sb != se; ++sb)
+        x = my_copy(traits::begin(sb), traits::end(sb), x);
+    return my_copy(traits::begin(se), traits::local(e), x);}
+
+// segmented output, random access input: fill each output segment with a contiguous kernel
+template <typename RI, typename OI>
+OI my_copy_kernel (RI b, RI e, OI x, segmented_output_kernel) {
+    typedef segmented_iterator_traits<OI> traits;
+    typedef typename std::iterator_traits<RI>::difference_type difference_type;
+    const OI y = x + (e - b);
+    typename traits::segment_iterator s = traits::segment(x);
+    typename traits::local_iterator   l = traits::local(x);
+    while (true) {
+        const difference_type n = std::min<difference_type>(e - b, traits::end(s) - l);
+        my_copy(b, b + n, l);
+        b += n;
+        if (b == e)
+            break;
+        ++s;
+        l = traits::begin(s);}
+    return y;}
+
+// counting input, contiguous output: generate the sequence instead of reading it
+template <typename II, typename OI>
+OI my_copy_kernel (II b, II e, OI x, iota_kernel) {
+    typedef contiguous_iterator_traits<OI> traits;
+    const typename std::iterator_traits<II>::difference_type n = e - b;
+    if (n != 0)
+        my_iota_contiguous(traits::pointer(x), traits::pointer(x) + n, *b, typename std::iterator_traits<II>::value_type(1));
+    return x + n;}
+
+template <typename II, typename OI>
+OI my_copy (II b, II e, OI x) {
+    return my_copy_kernel(b, e, x, typename copy_kernel<II, OI>::type());}
+
 #endif // Copy_h
@@ -0,0 +1,54 @@
+// -------------
+// CopyBench.c++
+// -------------
+
+#include <algorithm> // copy
+#include <cstdio>    // printf
+#include <cstdlib>   // atoi
+#include <deque>     // deque
+#include <vector>    // vector
+
+#include "Bench.h"
+#include "Copy.h"
+#include "Iota.h"
+#include "Range.h"
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const int m = (argc > 1) ? atoi(argv[1]) : (1 << 22);
+
+    printf("deque<int> -> vector<int>\n");
+    printf("%10s %12s %12s %12s\n", "n", "copy", "my_copy_loop", "my_copy");
+    for (int n = 1 << 8; n <= m; n <<= 2) {
+        const deque<int> x(n, 1);
+              vector<int> y(n);
+        const int r = (1 << 24) / n + 1;
+        const double t1 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(        copy(begin(x), end(x), begin(y)));});
+        const double t2 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(my_copy_loop(begin(x), end(x), begin(y)));});
+        const double t3 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(     my_copy(begin(x), end(x), begin(y)));});
+        printf("%10d %10.3fns %10.3fns %10.3fns\n", n, t1 * 1e9 / r / n, t2 * 1e9 / r / n, t3 * 1e9 / r / n);}
+
+    printf("vector<int> -> deque<int>\n");
+    printf("%10s %12s %12s %12s\n", "n", "copy", "my_copy_loop", "my_copy");
+    for (int n = 1 << 8; n <= m; n <<= 2) {
+        const vector<int> x(n, 1);
+              deque<int>  y(n);
+        const int r = (1 << 24) / n + 1;
+        const double t1 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(        copy(begin(x), end(x), begin(y)));});
+        const double t2 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(my_copy_loop(begin(x), end(x), begin(y)));});
+        const double t3 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(     my_copy(begin(x), end(x), begin(y)));});
+        printf("%10d %10.3fns %10.3fns %10.3fns\n", n, t1 * 1e9 / r / n, t2 * 1e9 / r / n, t3 * 1e9 / r / n);}
+
+    printf("Range<int> -> vector<int>, and a stride of 3\n");
+    printf("%10s %12s %12s %12s %12s %12s\n", "n", "copy", "my_copy_loop", "my_copy", "iota_loop", "my_iota");
+    for (int n = 1 << 8; n <= m; n <<= 2) {
+        const Range<int>  x(0, n);
+              vector<int> y(n);
+        const int r = (1 << 24) / n + 1;
+        const double t1 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(        copy(begin(x), end(x), begin(y)));});
+        const double t2 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(my_copy_loop(begin(x), end(x), begin(y)));});
+        const double t3 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(     my_copy(begin(x), end(x), begin(y)));});
+        const double t4 = bench([&] () {for (int i = 0; i != r; ++i) {my_iota_loop(begin(y), end(y), i, 3); do_not_optimize(y[0]);}});
+        const double t5 = bench([&] () {for (int i = 0; i != r; ++i) {     my_iota(begin(y), end(y), i, 3); do_not_optimize(y[0]);}});
+        printf("%10d %10.3fns %10.3fns %10.3fns %10.3fns %10.3fns\n", n, t1 * 1e9 / r / n, t2 * 1e9 / r / n, t3 * 1e9 / r / n, t4 * 1e9 / r / n, t5 * 1e9 / r / n);}
+    return 0;}
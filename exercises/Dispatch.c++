@@ -0,0 +1,191 @@
+// ------------
+// Dispatch.c++
+// ------------
+
+#include <atomic>      // atomic
+#include <cstddef>     // size_t
+#include <deque>       // deque
+#include <list>        // list
+#include <string>      // string
+#include <type_traits> // is_same
+#include <vector>      // vector
+
+#include "gtest/gtest.h"
+
+#include "AllOf.h"
+#include "Copy.h"
+#include "Dispatch.h"
+#include "Equal.h"
+#include "Fill.h"
+#include "Range.h"
+
+using namespace std;
+
+enum class Color : char {red, green, blue};
+
+struct Point {
+    int x;
+    int y;};
+
+// -----------
+// copy_kernel
+// -----------
+
+TEST(DispatchFixture, copy_1) {
+    ASSERT_TRUE((is_same<copy_kernel<int*,                        int*>                ::type, memmove_kernel>::value));
+    ASSERT_TRUE((is_same<copy_kernel<const int*,                  int*>                ::type, memmove_kernel>::value));
+    ASSERT_TRUE((is_same<copy_kernel<vector<int>::const_iterator, vector<int>::iterator>::type, memmove_kernel>::value));
+    ASSERT_TRUE((is_same<copy_kernel<Point*,                      Point*>              ::type, memmove_kernel>::value));}
+
+TEST(DispatchFixture, copy_2) {
+    ASSERT_TRUE((is_same<copy_kernel<const int*,     long*>  ::type, contiguous_kernel>::value));
+    ASSERT_TRUE((is_same<copy_kernel<const string*,  string*>::type, contiguous_kernel>::value));}
+
+TEST(DispatchFixture, copy_3) {
+    ASSERT_TRUE((is_same<copy_kernel<deque<int>::const_iterator, int*>                ::type, segmented_kernel>       ::value));
+    ASSERT_TRUE((is_same<copy_kernel<const int*,                 deque<int>::iterator>::type, segmented_output_kernel>::value));
+    ASSERT_TRUE((is_same<copy_kernel<Range<int>::iterator,       deque<int>::iterator>::type, segmented_output_kernel>::value));
+    ASSERT_TRUE((is_same<copy_kernel<list<int>::const_iterator,  deque<int>::iterator>::type, scalar_kernel>          ::value));}
+
+TEST(DispatchFixture, copy_4) {
+    ASSERT_TRUE((is_same<copy_kernel<Range<int>::iterator,        vector<int>::iterator> ::type, iota_kernel>  ::value));
+    ASSERT_TRUE((is_same<copy_kernel<Range<int>::iterator,        vector<long>::iterator>::type, scalar_kernel>::value));
+    ASSERT_TRUE((is_same<copy_kernel<list<int>::const_iterator,   vector<int>::iterator> ::type, scalar_kernel>::value));
+    ASSERT_TRUE((is_same<copy_kernel<vector<bool>::const_iterator, vector<bool>::iterator>::type, scalar_kernel>::value));}
+
+TEST(DispatchFixture, copy_5) {
+    const vector<int> x = {2, 3, 4, 5, 6};
+          vector<int> y(7);
+    ASSERT_EQ(begin(y) + 6, my_copy(begin(x), end(x), begin(y) + 1));
+    ASSERT_EQ(vector<int>({0, 2, 3, 4, 5, 6, 0}), y);}
+
+TEST(DispatchFixture, copy_6) {
+    vector<int> x = {2, 3, 4, 5, 6, 7};
+    ASSERT_EQ(begin(x) + 4, my_copy(begin(x) + 1, end(x) - 1, begin(x)));
+    ASSERT_EQ(vector<int>({3, 4, 5, 6, 6, 7}), x);}
+
+TEST(DispatchFixture, copy_7) {
+    const vector<string> x = {"abc", "def"};
+          vector<string> y(2);
+    my_copy(begin(x), end(x), begin(y));
+    ASSERT_EQ(x, y);}
+
+TEST(DispatchFixture, copy_8) {
+    ASSERT_TRUE (is_memmove_copyable<int>   ::value);
+    ASSERT_TRUE (is_memmove_copyable<Point> ::value);
+    ASSERT_TRUE (is_memmove_copyable<Color> ::value);
+    ASSERT_FALSE(is_memmove_copyable<string>::value);}
+
+// -----------
+// fill_kernel
+// -----------
+
+TEST(DispatchFixture, fill_1) {
+    ASSERT_TRUE((is_same<fill_kernel<char*,                  char>::type, memset_kernel>::value));
+    ASSERT_TRUE((is_same<fill_kernel<unsigned char*,         int> ::type, memset_kernel>::value));
+    ASSERT_TRUE((is_same<fill_kernel<vector<bool>::iterator, bool>::type, scalar_kernel>::value));
+    ASSERT_TRUE((is_same<fill_kernel<Color*,                 Color>::type, memset_kernel>::value));
+    ASSERT_TRUE((is_same<fill_kernel<string::iterator,       char>::type, memset_kernel>::value));}
+
+TEST(DispatchFixture, fill_2) {
+    ASSERT_TRUE((is_same<fill_kernel<int*,                  int>::type, contiguous_kernel>::value));
+    ASSERT_TRUE((is_same<fill_kernel<vector<int>::iterator, int>::type, contiguous_kernel>::value));
+    ASSERT_TRUE((is_same<fill_kernel<deque<int>::iterator,  int>::type, segmented_kernel> ::value));
+    ASSERT_TRUE((is_same<fill_kernel<list<int>::iterator,   int>::type, scalar_kernel>    ::value));}
+
+TEST(DispatchFixture, fill_3) {
+    string x = "abcdef";
+    my_fill(begin(x) + 1, end(x) - 1, 'z');
+    ASSERT_EQ("azzzzf", x);}
+
+TEST(DispatchFixture, fill_4) {
+    vector<Color> x(4, Color::red);
+    my_fill(begin(x) + 1, end(x), Color::blue);
+    ASSERT_EQ(vector<Color>({Color::red, Color::blue, Color::blue, Color::blue}), x);}
+
+TEST(DispatchFixture, fill_5) {
+    vector<unsigned char> x(3);
+    my_fill(begin(x), end(x), 257);
+    ASSERT_EQ(vector<unsigned char>(3, 1), x);}
+
+// ------------
+// equal_kernel
+// ------------
+
+TEST(DispatchFixture, equal_1) {
+    ASSERT_TRUE((is_same<equal_kernel<const int*,                  const int*>                 ::type, memcmp_kernel>::value));
+    ASSERT_TRUE((is_same<equal_kernel<vector<int>::const_iterator, int*>                       ::type, memcmp_kernel>::value));
+    ASSERT_TRUE((is_same<equal_kernel<const Color*,                const Color*>               ::type, memcmp_kernel>::value));
+    ASSERT_TRUE((is_same<equal_kernel<int* const*,                 int**>                      ::type, memcmp_kernel>::value));}
+
+TEST(DispatchFixture, equal_2) {
+    ASSERT_TRUE((is_same<equal_kernel<const double*, const double*>::type, chunked_kernel>::value));
+    ASSERT_TRUE((is_same<equal_kernel<const Point*,  const Point*> ::type, chunked_kernel>::value));
+    ASSERT_TRUE((is_same<equal_kernel<const int*,    const long*>  ::type, chunked_kernel>::value));}
+
+TEST(DispatchFixture, equal_3) {
+    ASSERT_TRUE((is_same<equal_kernel<deque<int>::const_iterator, const int*>                ::type, segmented_kernel>::value));
+    ASSERT_TRUE((is_same<equal_kernel<deque<int>::const_iterator, list<int>::const_iterator>::type, scalar_kernel>   ::value));
+    ASSERT_TRUE((is_same<equal_kernel<list<int>::const_iterator,  const int*>                ::type, scalar_kernel>   ::value));
+    ASSERT_TRUE((is_same<equal_kernel<Range<int>::iterator,       const int*>                ::type, scalar_kernel>   ::value));}
+
+TEST(DispatchFixture, equal_4) {
+    const vector<double> x = {0.0, 1.5, 2.5};
+    const vector<double> y = {-0.0, 1.5, 2.5};
+    ASSERT_TRUE(my_equal(begin(x), end(x), begin(y)));}
+
+TEST(DispatchFixture, equal_5) {
+    vector<int> x(1000);
+    vector<int> y(1000);
+    ASSERT_TRUE(my_equal(begin(x), end(x), begin(y)));
+    y[999] = 1;
+    ASSERT_FALSE(my_equal(begin(x), end(x), begin(y)));}
+
+TEST(DispatchFixture, equal_6) {
+    deque<int>  x;
+    vector<int> y;
+    for (int i = 0; i != 1000; ++i) {
+        x.push_back(i);
+        y.push_back(i);}
+    ASSERT_TRUE(my_equal(begin(x) + 3, end(x) - 5, begin(y) + 3));
+    y[700] = -1;
+    ASSERT_FALSE(my_equal(begin(x) + 3, end(x) - 5, begin(y) + 3));}
+
+// -------------
+// all_of_kernel
+// -------------
+
+TEST(DispatchFixture, all_of_1) {
+    ASSERT_TRUE((is_same<all_of_kernel<const int*>                 ::type, chunked_kernel>  ::value));
+    ASSERT_TRUE((is_same<all_of_kernel<vector<int>::const_iterator>::type, chunked_kernel>  ::value));
+    ASSERT_TRUE((is_same<all_of_kernel<deque<int>::const_iterator> ::type, segmented_kernel>::value));
+    ASSERT_TRUE((is_same<all_of_kernel<list<int>::const_iterator>  ::type, scalar_kernel>   ::value));
+    ASSERT_TRUE((is_same<all_of_kernel<Range<int>::iterator>       ::type, scalar_kernel>   ::value));}
+
+TEST(DispatchFixture, all_of_2) {
+    deque<int> x;
+    for (int i = 0; i != 1000; ++i)
+        x.push_back(i);
+    ASSERT_TRUE (my_all_of (begin(x), end(x), [] (int v) {return v >= 0;}));
+    ASSERT_FALSE(my_all_of (begin(x), end(x), [] (int v) {return v != 600;}));
+    ASSERT_TRUE (my_any_of (begin(x), end(x), [] (int v) {return v == 999;}));
+    ASSERT_TRUE (my_none_of(begin(x), end(x), [] (int v) {return v < 0;}));}
+
+// ----------------
+// dispatch_threads
+// ----------------
+
+TEST(DispatchFixture, threads_1) {
+    ASSERT_EQ(1u, dispatch_threads(0,                              8));
+    ASSERT_EQ(1u, dispatch_threads(DISPATCH_PARALLEL_MIN - 1,      8));
+    ASSERT_EQ(2u, dispatch_threads(DISPATCH_PARALLEL_MIN * 2,      8));
+    ASSERT_EQ(8u, dispatch_threads(DISPATCH_PARALLEL_MIN * 100,    8));
+    ASSERT_EQ(1u, dispatch_threads(DISPATCH_PARALLEL_MIN * 100,    0));}
+
+TEST(DispatchFixture, threads_2) {
+    vector<atomic<int>> x(1001);
+    parallel_blocks(x.size(), 4, [&x] (size_t i, size_t j) {
+        for (; i != j; ++i)
+            ++x[i];});
+    for (const atomic<int>& v : x)
+        ASSERT_EQ(1, v.load());}
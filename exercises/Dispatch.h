@@ -0,0 +1,232 @@
+// ----------
+// Dispatch.h
+// ----------
+
+#ifndef Dispatch_h
+#define Dispatch_h
+
+#include <algorithm>   // min
+#include <cstddef>     // size_t
+#include <iterator>    // iterator_traits
+#include <thread>      // thread
+#include <type_traits> // conditional, integral_constant, is_enum, is_integral, is_pointer, is_same, ...
+#include <vector>      // vector
+
+#include "ContiguousIterator.h"
+#include "Iota.h"
+#include "SegmentedIterator.h"
+
+/*
+picks the kernel that an algorithm runs from the iterator and value types,
+at compile time, so that each algorithm only writes its kernels once
+and every algorithm agrees on which iterator kinds get which kernel
+
+each selector has a nested type, one of the kernel tags,
+and the algorithm overloads its kernel on that tag
+*/
+
+// -------
+// kernels
+// -------
+
+struct scalar_kernel           {}; // one element at a time through the iterators
+struct contiguous_kernel       {}; // the same loop on raw pointers, which the compiler can vectorize
+struct chunked_kernel          {}; // blocks without branches on raw pointers, exit at block boundaries
+struct segmented_kernel        {}; // a contiguous kernel per segment of the input
+struct segmented_output_kernel {}; // a contiguous kernel per segment of the output
+struct iota_kernel             {}; // generate the values of a counting input
+struct memmove_kernel          {}; // memmove, split across threads when large
+struct memset_kernel           {}; // memset, split across threads when large
+struct memcmp_kernel           {}; // memcmp, split across threads when large
+
+// -------
+// helpers
+// -------
+
+template <typename I>
+struct iterator_value :
+        std::remove_cv<typename std::iterator_traits<I>::value_type>
+    {};
+
+template <typename I1, typename I2>
+struct is_same_value :
+        std::is_same<typename iterator_value<I1>::type, typename iterator_value<I2>::type>
+    {};
+
+// -------------------
+// is_memmove_copyable
+// -------------------
+
+/*
+a copy of the values is a copy of their bytes, so memmove can copy them
+std::is_trivially_copyable, which libstdc++ only has from GCC 5 on,
+before that the compiler's __has_trivial_copy
+*/
+
+#if defined(__GLIBCXX__) && defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 5)
+template <typename T>
+struct is_memmove_copyable :
+        std::integral_constant<bool, __has_trivial_copy(T)>
+    {};
+#else
+template <typename T>
+struct is_memmove_copyable :
+        std::is_trivially_copyable<T>
+    {};
+#endif
+
+// -----------------------
+// is_trivially_comparable
+// -----------------------
+
+/*
+== on the values is == on their bytes, so memcmp can compare them
+not floating point, 0.0 == -0.0 and NaN != NaN
+not classes, padding bytes are unspecified
+specialize it for a type that qualifies
+*/
+
+template <typename T>
+struct is_trivially_comparable :
+        std::integral_constant<bool,
+            std::is_integral<T>::value ||
+            std::is_enum<T>::value     ||
+            std::is_pointer<T>::value>
+    {};
+
+// -----------
+// copy_kernel
+// -----------
+
+template <typename II, typename OI>
+struct copy_kernel {
+    static const bool contiguous =
+        is_contiguous_iterator<II>::value && is_contiguous_iterator<OI>::value;
+
+    typedef
+        typename std::conditional<is_counting_iterator<II>::value && is_contiguous_iterator<OI>::value && is_same_value<II, OI>::value,
+            iota_kernel,
+        typename std::conditional<contiguous && is_same_value<II, OI>::value && is_memmove_copyable<typename iterator_value<II>::type>::value,
+            memmove_kernel,
+        typename std::conditional<contiguous,
+            contiguous_kernel,
+        typename std::conditional<is_segmented_iterator<II>::value,
+            segmented_kernel,
+        typename std::conditional<is_segmented_iterator<OI>::value && is_random_access_iterator<II>::value,
+            segmented_output_kernel,
+            scalar_kernel>::type>::type>::type>::type>::type type;};
+
+// -----------
+// fill_kernel
+// -----------
+
+template <typename FI, typename T>
+struct fill_kernel {
+    typedef typename iterator_value<FI>::type value_type;
+
+    static const bool byte =
+        (sizeof(value_type) == 1) && (std::is_integral<value_type>::value || std::is_enum<value_type>::value);
+
+    typedef
+        typename std::conditional<is_contiguous_iterator<FI>::value && byte,
+            memset_kernel,
+        typename std::conditional<is_contiguous_iterator<FI>::value,
+            contiguous_kernel,
+        typename std::conditional<is_segmented_iterator<FI>::value,
+            segmented_kernel,
+            scalar_kernel>::type>::type>::type type;};
+
+// ------------
+// equal_kernel
+// ------------
+
+template <typename II1, typename II2>
+struct equal_kernel {
+    static const bool contiguous =
+        is_contiguous_iterator<II1>::value && is_contiguous_iterator<II2>::value;
+
+    typedef
+        typename std::conditional<contiguous && is_same_value<II1, II2>::value && is_trivially_comparable<typename iterator_value<II1>::type>::value,
+            memcmp_kernel,
+        typename std::conditional<contiguous,
+            chunked_kernel,
+        typename std::conditional<is_segmented_iterator<II1>::value && is_random_access_iterator<II2>::value,
+            segmented_kernel,
+            scalar_kernel>::type>::type>::type type;};
+
+// -------------
+// all_of_kernel
+// -------------
+
+/*
+for all_of, any_of, and none_of
+the predicate is user code, so these never go parallel
+*/
+
+template <typename II>
+struct all_of_kernel {
+    typedef
+        typename std::conditional<is_contiguous_iterator<II>::value,
+            chunked_kernel,
+        typename std::conditional<is_segmented_iterator<II>::value,
+            segmented_kernel,
+            scalar_kernel>::type>::type type;};
+
+// ---------------------
+// DISPATCH_PARALLEL_MIN
+// ---------------------
+
+/*
+the number of bytes that each thread of a memmove, memset, or memcmp kernel
+has to have before the kernel is split, below it a thread costs more than it saves
+*/
+
+#ifndef DISPATCH_PARALLEL_MIN
+#define DISPATCH_PARALLEL_MIN (std::size_t(1) << 22)
+#endif
+
+// ----------------
+// dispatch_threads
+// ----------------
+
+/*
+the number of threads for a kernel of n bytes,
+hardware_concurrency is a system call, so it is only asked for once, and only for a large n
+*/
+
+inline unsigned dispatch_threads (std::size_t n, unsigned t) {
+    const std::size_t m = n / DISPATCH_PARALLEL_MIN;
+    if (t == 0)
+        t = 1;
+    return (m < t) ? ((m == 0) ? 1 : static_cast<unsigned>(m)) : t;}
+
+inline unsigned dispatch_threads (std::size_t n) {
+    if (n < 2 * DISPATCH_PARALLEL_MIN)
+        return 1;
+    static const unsigned t = std::thread::hardware_concurrency();
+    return dispatch_threads(n, t);}
+
+// ---------------
+// parallel_blocks
+// ---------------
+
+/*
+calls f(i, j) on t contiguous blocks that cover [0, n), one thread per block
+the calling thread takes the last block
+*/
+
+template <typename F>
+void parallel_blocks (std::size_t n, unsigned t, F f) {
+    if (t <= 1) {
+        f(std::size_t(0), n);
+        return;}
+    const std::size_t        k = n / t;
+    std::vector<std::thread> x;
+    x.reserve(t - 1);
+    for (unsigned i = 0; i != t - 1; ++i)
+        x.emplace_back(f, i * k, (i + 1) * k);
+    f((t - 1) * k, n);
+    for (std::thread& th : x)
+        th.join();}
+
+#endif // Dispatch_h
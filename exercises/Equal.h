@@ -5,8 +5,17 @@
 #ifndef Equal_h
 #define Equal_h
 
+#include <atomic>  // atomic
+#include <cstddef> // size_t
+#include <cstring> // memcmp
+
+#include "Dispatch.h"
+
 template <typename II1, typename II2>
-bool my_equal (II1 b, II1 e, II2 c) {
+bool my_equal (II1 b, II1 e, II2 c);
+
+template <typename II1, typename II2>
+bool my_equal_loop (II1 b, II1 e, II2 c) {
     while (b != e) {
         if (*b != *c)
             return false;
@@ -14,4 +23,67 @@ bool my_equal (II1 b, II1 e, II2 c) {
         ++c;}
     return true;}
 
+template <typename II1, typename II2>
+bool my_equal_kernel (II1 b, II1 e, II2 c, scalar_kernel) {
+    return my_equal_loop(b, e, c);}
+
+/*
+blocks of N compared without branching, the differences or'ed into an unsigned,
+the loop only exits at a block boundary
+*/
+
+template <std::size_t N = 64, typename T1, typename T2>
+bool my_equal_chunked (const T1* b, const T1* e, const T2* c) {
+    static_assert(N > 0, "N must be positive");
+    while (static_cast<std::size_t>(e - b) >= N) {
+        unsigned r = 0;
+        for (std::size_t i = 0; i != N; ++i)
+            r |= ((b[i] != c[i]) ? 1u : 0u);
+        if (r)
+            return false;
+        b += N;
+        c += N;}
+    return my_equal_loop(b, e, c);}
+
+template <typename II1, typename II2>
+bool my_equal_kernel (II1 b, II1 e, II2 c, chunked_kernel) {
+    return my_equal_chunked(contiguous_iterator_traits<II1>::pointer(b), contiguous_iterator_traits<II1>::pointer(e), contiguous_iterator_traits<II2>::pointer(c));}
+
+// split across threads when large, once a block finds a difference, blocks that have not called memcmp yet skip it
+template <typename II1, typename II2>
+bool my_equal_kernel (II1 b, II1 e, II2 c, memcmp_kernel) {
+    typedef typename iterator_value<II1>::type value_type;
+    const std::size_t n = e - b;
+    if (n == 0)
+        return true;
+    const char*       p = reinterpret_cast<const char*>(contiguous_iterator_traits<II1>::pointer(b));
+    const char*       q = reinterpret_cast<const char*>(contiguous_iterator_traits<II2>::pointer(c));
+    const std::size_t s = n * sizeof(value_type);
+    std::atomic<bool> r(true);
+    parallel_blocks(s, dispatch_threads(s), [p, q, &r] (std::size_t i, std::size_t j) {
+        if (r.load(std::memory_order_relaxed) && (std::memcmp(p + i, q + i, j - i) != 0))
+            r.store(false, std::memory_order_relaxed);});
+    return r.load();}
+
+// segmented input, random access second input: compare each segment with a contiguous kernel
+template <typename II1, typename RI2>
+bool my_equal_kernel (II1 b, II1 e, RI2 c, segmented_kernel) {
+    typedef segmented_iterator_traits<II1> traits;
+    typename traits::segment_iterator sb = traits::segment(b);
+    typename traits::segment_iterator se = traits::segment(e);
+    if (sb == se)
+        return my_equal(traits::local(b), traits::local(e), c);
+    if (!my_equal(traits::local(b), traits::end(sb), c))
+        return false;
+    c += traits::end(sb) - traits::local(b);
+    for (++sb; sb != se; ++sb) {
+        if (!my_equal(traits::begin(sb), traits::end(sb), c))
+            return false;
+        c += traits::end(sb) - traits::begin(sb);}
+    return my_equal(traits::begin(se), traits::local(e), c);}
+
+template <typename II1, typename II2>
+bool my_equal (II1 b, II1 e, II2 c) {
+    return my_equal_kernel(b, e, c, typename equal_kernel<II1, II2>::type());}
+
 #endif // Equal_h
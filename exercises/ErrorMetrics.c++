@@ -0,0 +1,67 @@
+// ----------------
+// ErrorMetrics.c++
+// ----------------
+
+#include <list>   // list
+#include <vector> // vector
+
+#include "gtest/gtest.h"
+
+#include "ErrorMetrics.h"
+
+using namespace std;
+
+TEST(ErrorMetricsFixture, test_1) {
+    const vector<double> a = {2, 3, 4};
+    const vector<double> p = {4, 3, 2};
+    const Error_Metrics<double> r = error_metrics<metric::all>(begin(a), end(a), begin(p));
+    ASSERT_EQ(3, r.n);
+    ASSERT_FLOAT_EQ(1.6329932,   r.rmse);
+    ASSERT_FLOAT_EQ(4.0 / 3,     r.mae);
+    ASSERT_FLOAT_EQ(2,           r.max_error);
+    ASSERT_FLOAT_EQ(0,           r.bias);}
+
+TEST(ErrorMetricsFixture, test_2) {
+    const list<double>   a = {2, 3, 4};
+    const vector<double> p = {3, 2, 7};
+    const Error_Metrics<double> r = error_metrics<metric::all>(begin(a), end(a), begin(p));
+    ASSERT_EQ(3, r.n);
+    ASSERT_FLOAT_EQ(1.9148542,   r.rmse);
+    ASSERT_FLOAT_EQ(5.0 / 3,     r.mae);
+    ASSERT_FLOAT_EQ(3,           r.max_error);
+    ASSERT_FLOAT_EQ(-1,          r.bias);}
+
+TEST(ErrorMetricsFixture, test_3) {
+    const vector<double> a = {2, 3, 4};
+    const vector<double> p = {3, 2, 7};
+    const Error_Metrics<double> r = error_metrics<metric::mae | metric::bias>(begin(a), end(a), begin(p));
+    ASSERT_EQ(0,                 r.rmse);
+    ASSERT_FLOAT_EQ(5.0 / 3,     r.mae);
+    ASSERT_EQ(0,                 r.max_error);
+    ASSERT_FLOAT_EQ(-1,          r.bias);}
+
+TEST(ErrorMetricsFixture, test_4) {
+    const int     n = 1001;
+    vector<float> a(n);
+    vector<float> p(n);
+    for (int i = 0; i != n; ++i) {
+        a[i] = i;
+        p[i] = i + ((i % 2) ? 2 : -2);}
+    p[500] = 510;
+    const Error_Metrics<float> r = error_metrics<metric::all>(a.data(), a.data() + n, p.data());
+    ASSERT_EQ(n, r.n);
+    ASSERT_FLOAT_EQ(10,                      r.max_error);
+    ASSERT_FLOAT_EQ((2.0 * 1000 + 10) / n,   r.mae);
+    ASSERT_FLOAT_EQ((4.0 * 1000 + 100) / n,  r.rmse * r.rmse);}
+
+TEST(ErrorMetricsFixture, test_5) {
+    const vector<double> a;
+    const Error_Metrics<double> r = error_metrics<metric::all>(begin(a), end(a), begin(a));
+    ASSERT_EQ(0, r.n);
+    ASSERT_EQ(0, r.rmse);}
+
+TEST(ErrorMetricsFixture, test_6) {
+    ASSERT_EQ( 64u, sizeof(Error_Lanes<metric::rmse,                double>));
+    ASSERT_EQ(128u, sizeof(Error_Lanes<metric::mae | metric::bias,  double>));
+    ASSERT_EQ(256u, sizeof(Error_Lanes<metric::all,                 double>));
+    ASSERT_EQ( 64u, sizeof(Error_Lanes<metric::max_error,           float>));}
@@ -0,0 +1,180 @@
+// --------------
+// ErrorMetrics.h
+// --------------
+
+#ifndef ErrorMetrics_h
+#define ErrorMetrics_h
+
+#include <cmath>       // abs, sqrt
+#include <cstddef>     // ptrdiff_t, size_t
+#include <iterator>    // iterator_traits
+
+#include "RMSE.h"
+
+/*
+several error metrics of (actual, predicted) in one pass
+the metrics are picked at compile time with a mask of metric bits,
+so a metric that is not asked for has no lanes and no work
+
+rmse      : sqrt(mean((a - p)^2))
+mae       : mean(|a - p|)
+max_error : max(|a - p|)
+bias      : mean(a - p)
+*/
+
+struct metric {
+    static const unsigned rmse      = 1;
+    static const unsigned mae       = 2;
+    static const unsigned max_error = 4;
+    static const unsigned bias      = 8;
+    static const unsigned all       = rmse | mae | max_error | bias;};
+
+template <typename T>
+struct Error_Metrics {
+    std::ptrdiff_t n;
+    T              rmse;
+    T              mae;
+    T              max_error;
+    T              bias;};
+
+// ------------
+// Metric_Lanes
+// ------------
+
+/*
+the lanes of one metric, each one like Square_Lanes in RMSE.h,
+with N lanes of partial results, add, and a reduce over the lanes
+a metric that is not asked for gets the empty specialization,
+no storage, an add that does nothing, and a reduce of T()
+*/
+
+template <typename T>
+struct Absolute_Lanes {
+    typedef T value_type;
+
+    static const std::size_t N = 64 / sizeof(T);
+
+    T a[N];
+
+    Absolute_Lanes () :
+            a ()
+        {}
+
+    void add (std::size_t i, T x, T y) {
+        a[i] += std::abs(x - y);}
+
+    T reduce () {
+        for (std::size_t n = N / 2; n != 0; n /= 2)
+            for (std::size_t i = 0; i != n; ++i)
+                a[i] += a[i + n];
+        return a[0];}};
+
+template <typename T>
+struct Max_Lanes {
+    typedef T value_type;
+
+    static const std::size_t N = 64 / sizeof(T);
+
+    T a[N];
+
+    Max_Lanes () :
+            a ()
+        {}
+
+    void add (std::size_t i, T x, T y) {
+        const T d = std::abs(x - y);
+        a[i] = (d > a[i]) ? d : a[i];}
+
+    T reduce () {
+        for (std::size_t n = N / 2; n != 0; n /= 2)
+            for (std::size_t i = 0; i != n; ++i)
+                a[i] = (a[i + n] > a[i]) ? a[i + n] : a[i];
+        return a[0];}};
+
+template <typename T>
+struct Difference_Lanes {
+    typedef T value_type;
+
+    static const std::size_t N = 64 / sizeof(T);
+
+    T a[N];
+
+    Difference_Lanes () :
+            a ()
+        {}
+
+    void add (std::size_t i, T x, T y) {
+        a[i] += (x - y);}
+
+    T reduce () {
+        for (std::size_t n = N / 2; n != 0; n /= 2)
+            for (std::size_t i = 0; i != n; ++i)
+                a[i] += a[i + n];
+        return a[0];}};
+
+template <bool B, typename L>
+struct Metric_Lanes : L {};
+
+template <typename L>
+struct Metric_Lanes<false, L> {
+    typedef typename L::value_type T;
+
+    void add (std::size_t, T, T)
+        {}
+
+    T reduce () {
+        return T();}};
+
+// -----------
+// Error_Lanes
+// -----------
+
+/*
+the lanes of the metrics in M, and only those
+*/
+
+template <unsigned M, typename T>
+struct Error_Lanes :
+        Metric_Lanes<(M & metric::rmse)      != 0, Square_Lanes<T>>,
+        Metric_Lanes<(M & metric::mae)       != 0, Absolute_Lanes<T>>,
+        Metric_Lanes<(M & metric::max_error) != 0, Max_Lanes<T>>,
+        Metric_Lanes<(M & metric::bias)      != 0, Difference_Lanes<T>> {
+    typedef Metric_Lanes<(M & metric::rmse)      != 0, Square_Lanes<T>>     rmse_lanes;
+    typedef Metric_Lanes<(M & metric::mae)       != 0, Absolute_Lanes<T>>   mae_lanes;
+    typedef Metric_Lanes<(M & metric::max_error) != 0, Max_Lanes<T>>        max_error_lanes;
+    typedef Metric_Lanes<(M & metric::bias)      != 0, Difference_Lanes<T>> bias_lanes;
+
+    static const std::size_t N = 64 / sizeof(T);
+
+    void add (std::size_t i, T a, T p) {
+        rmse_lanes::add(i, a, p);
+        mae_lanes::add(i, a, p);
+        max_error_lanes::add(i, a, p);
+        bias_lanes::add(i, a, p);}
+
+    Error_Metrics<T> result (std::ptrdiff_t n) {
+        Error_Metrics<T> r = {n, T(), T(), T(), T()};
+        if (n == 0)
+            return r;
+        r.rmse      = (M & metric::rmse) ? std::sqrt(rmse_lanes::reduce() / n) : T();
+        r.mae       = mae_lanes::reduce() / n;
+        r.max_error = max_error_lanes::reduce();
+        r.bias      = bias_lanes::reduce() / n;
+        return r;}};
+
+// -------------
+// error_metrics
+// -------------
+
+/**
+ * the lanes are driven by wide_lanes, the kernel of wide_sum in RMSE.h
+ */
+template <unsigned M, typename II1, typename II2>
+Error_Metrics<typename std::iterator_traits<II1>::value_type> error_metrics (II1 b, II1 e, II2 c) {
+    static_assert((M != 0) && ((M & ~metric::all) == 0), "M must be a nonempty mask of metric bits");
+    typedef typename std::iterator_traits<II1>::value_type T;
+    Error_Lanes<M, T> l;
+    const std::ptrdiff_t n = wide_lanes(b, e, c, l);
+    return l.result(n);}
+
+#endif // ErrorMetrics_h
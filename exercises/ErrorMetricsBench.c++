@@ -0,0 +1,61 @@
+// ---------------------
+// ErrorMetricsBench.c++
+// ---------------------
+
+#include <cmath>   // abs
+#include <cstdio>  // printf
+#include <cstdlib> // atoi
+#include <vector>  // vector
+
+#include "Bench.h"
+#include "ErrorMetrics.h"
+#include "RMSE.h"
+
+template <typename T>
+T mae (const T* b, const T* e, const T* c) {
+    const std::ptrdiff_t n = (e - b);
+    T v = 0;
+    for (; b != e; ++b, ++c)
+        v += std::abs(*b - *c);
+    return v / n;}
+
+template <typename T>
+T max_error (const T* b, const T* e, const T* c) {
+    T v = 0;
+    for (; b != e; ++b, ++c)
+        v = (std::abs(*b - *c) > v) ? std::abs(*b - *c) : v;
+    return v;}
+
+template <typename T>
+T bias (const T* b, const T* e, const T* c) {
+    const std::ptrdiff_t n = (e - b);
+    T v = 0;
+    for (; b != e; ++b, ++c)
+        v += (*b - *c);
+    return v / n;}
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const int m = (argc > 1) ? atoi(argv[1]) : (1 << 24);
+
+    printf("%10s %12s %12s %12s %12s\n", "n", "separate", "fused all", "rmse_unrolled", "fused rmse");
+    for (int n = 1 << 10; n <= m; n <<= 2) {
+        vector<double> x(n);
+        vector<double> y(n);
+        for (int i = 0; i != n; ++i) {
+            x[i] = i % 1000;
+            y[i] = (i + 3) % 1000;}
+        const double* const b = x.data();
+        const double* const e = b + n;
+        const double* const c = y.data();
+        const int           r = (1 << 24) / n + 1;
+        const double t1 = bench([&] () {for (int i = 0; i != r; ++i) {
+            do_not_optimize(rmse_unrolled(b, e, c, 0.0));
+            do_not_optimize(mae(b, e, c));
+            do_not_optimize(max_error(b, e, c));
+            do_not_optimize(bias(b, e, c));}});
+        const double t2 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(error_metrics<metric::all>(b, e, c));});
+        const double t3 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(rmse_unrolled(b, e, c, 0.0));});
+        const double t4 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(error_metrics<metric::rmse>(b, e, c));});
+        printf("%10d %10.3fns %10.3fns %10.3fns %10.3fns\n", n, t1 * 1e9 / r / n, t2 * 1e9 / r / n, t3 * 1e9 / r / n, t4 * 1e9 / r / n);}
+    return 0;}
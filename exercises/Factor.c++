@@ -0,0 +1,68 @@
+// ----------
+// Factor.c++
+// ----------
+
+// https://en.wikipedia.org/wiki/Pollard%27s_rho_algorithm
+
+#include <cstdint> // uint64_t
+#include <random>  // mt19937_64
+#include <vector>  // vector
+
+#include "gtest/gtest.h"
+
+#include "Factor.h"
+
+using namespace std;
+
+typedef vector<uint64_t> factors;
+
+TEST(FactorFixture, test_1) {
+    ASSERT_EQ(factors(),              factor(0));
+    ASSERT_EQ(factors(),              factor(1));
+    ASSERT_EQ(factors({2}),           factor(2));
+    ASSERT_EQ(factors({2, 2, 2, 3}),  factor(24));
+    ASSERT_EQ(factors({3, 3, 37}),    factor(333));
+    ASSERT_EQ(factors({1021, 1021}),  factor(1021 * 1021));
+    ASSERT_EQ(factors({1031, 1031}),  factor(1031 * 1031));}
+
+TEST(FactorFixture, test_2) {
+    ASSERT_EQ(factors({4294967279ULL, 4294967291ULL}),    factor(4294967291ULL * 4294967279ULL));
+    ASSERT_EQ(factors({18446744073709551557ULL}),         factor(18446744073709551557ULL));
+    ASSERT_EQ(factors({3, 5, 17, 257, 641, 65537, 6700417}), factor(18446744073709551615ULL));}
+
+TEST(FactorFixture, test_3) {
+    ASSERT_EQ(factors({2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                       2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2}),
+              factor(uint64_t(1) << 63));
+    ASSERT_EQ(factors({1048573, 1048573, 1048573}), factor(1048573ULL * 1048573ULL * 1048573ULL));}
+
+TEST(FactorFixture, test_4) {
+    mt19937_64 g(1);
+    for (int i = 0; i != 2000; ++i) {
+        const uint64_t n = g();
+        const factors  v = factor(n);
+        uint64_t p = 1;
+        for (size_t j = 0; j != v.size(); ++j) {
+            ASSERT_TRUE(is_prime(v[j])) << n;
+            if (j != 0) {
+                ASSERT_LE(v[j - 1], v[j]);}
+            p *= v[j];}
+        ASSERT_EQ(n, p);}}
+
+TEST(FactorFixture, test_5) {
+    mt19937_64 g(2);
+    vector<uint64_t> x(1000);
+    for (uint64_t& n : x)
+        n = g();
+    vector<factors> y(x.size());
+    factor(x.begin(), x.end(), y.begin(), 4);
+    for (size_t i = 0; i != x.size(); ++i)
+        ASSERT_EQ(factor(x[i]), y[i]);}
+
+TEST(FactorFixture, test_6) {
+    const uint64_t x[] = {12, 97, 1};
+    factors y[3];
+    factor(x, x + 3, y, 8);
+    ASSERT_EQ(factors({2, 2, 3}), y[0]);
+    ASSERT_EQ(factors({97}),      y[1]);
+    ASSERT_EQ(factors(),          y[2]);}
@@ -0,0 +1,171 @@
+// --------
+// Factor.h
+// --------
+
+#ifndef Factor_h
+#define Factor_h
+
+#include <algorithm> // min, sort, swap
+#include <atomic>    // atomic
+#include <cstddef>   // ptrdiff_t
+#include <cstdint>   // uint32_t, uint64_t
+#include <thread>    // thread
+#include <vector>    // vector
+
+#include "IsPrime3.h"
+#include "Montgomery.h"
+
+/*
+64 bit factorization
+trial division by the primes below 2^10 strips the small factors,
+what is left is either 1, a prime, or a product of factors above 2^10,
+which Pollard-Brent rho splits with Montgomery arithmetic
+is_prime decides when a cofactor is done
+*/
+
+// ----------
+// binary_gcd
+// ----------
+
+inline std::uint64_t binary_gcd (std::uint64_t a, std::uint64_t b) {
+    if (a == 0)
+        return b;
+    if (b == 0)
+        return a;
+    const int k = __builtin_ctzll(a | b);
+    a >>= __builtin_ctzll(a);
+    while (b != 0) {
+        b >>= __builtin_ctzll(b);
+        if (a > b)
+            std::swap(a, b);
+        b -= a;}
+    return a << k;}
+
+// ------------
+// small_primes
+// ------------
+
+/**
+ * the odd primes below 2^10
+ */
+inline const std::vector<std::uint32_t>& small_primes () {
+    static const std::vector<std::uint32_t> p = [] () {
+        std::vector<std::uint32_t> v;
+        for (std::uint32_t n = 3; n < 1024; n += 2)
+            if (is_prime(n))
+                v.push_back(n);
+        return v;}();
+    return p;}
+
+// ---------
+// rho_brent
+// ---------
+
+/*
+n odd and composite
+iterates y = y^2 + c, accumulating 128 differences into one product
+before each gcd, and backtracks one step at a time if the batch
+overshoots to n
+returns a factor of n, possibly n itself, then try another c
+https://en.wikipedia.org/wiki/Pollard%27s_rho_algorithm#Variants
+*/
+
+inline std::uint64_t rho_brent (const Montgomery& m, std::uint64_t c) {
+    const std::uint64_t n = m.modulus();
+    const std::uint64_t a = m.to(c);
+    const std::uint64_t M = 128;
+    std::uint64_t x  = 0;
+    std::uint64_t y  = m.to(2);
+    std::uint64_t ys = y;
+    std::uint64_t q  = m.one();
+    std::uint64_t g  = 1;
+    for (std::uint64_t r = 1; g == 1; r *= 2) {
+        x = y;
+        for (std::uint64_t i = 0; i != r; ++i)
+            y = m.add(m.mul(y, y), a);
+        for (std::uint64_t k = 0; (k < r) && (g == 1); k += M) {
+            ys = y;
+            for (std::uint64_t i = 0; i != std::min(M, r - k); ++i) {
+                y = m.add(m.mul(y, y), a);
+                q = m.mul(q, m.sub(x, y));}
+            g = binary_gcd(q, n);}}
+    if (g == n)
+        do {
+            ys = m.add(m.mul(ys, ys), a);
+            g  = binary_gcd(m.sub(x, ys), n);}
+        while (g == 1);
+    return g;}
+
+// ----------
+// factor_rho
+// ----------
+
+/*
+n odd, with no factor below 2^10
+*/
+
+inline void factor_rho (std::uint64_t n, std::vector<std::uint64_t>& v) {
+    if (n == 1)
+        return;
+    if (is_prime(n)) {
+        v.push_back(n);
+        return;}
+    const Montgomery m(n);
+    std::uint64_t d = n;
+    for (std::uint64_t c = 1; d == n; ++c)
+        d = rho_brent(m, c);
+    factor_rho(d,     v);
+    factor_rho(n / d, v);}
+
+// ------
+// factor
+// ------
+
+/**
+ * the prime factors of n, with multiplicity, in increasing order
+ * 0 and 1 have none
+ */
+inline std::vector<std::uint64_t> factor (std::uint64_t n) {
+    std::vector<std::uint64_t> v;
+    if (n < 2)
+        return v;
+    const int z = __builtin_ctzll(n);
+    v.assign(z, 2);
+    n >>= z;
+    const std::vector<std::uint32_t>& p = small_primes();
+    std::size_t i = 0;
+    for (; (i != p.size()) && (std::uint64_t(p[i]) * p[i] <= n); ++i)
+        while ((n % p[i]) == 0) {
+            v.push_back(p[i]);
+            n /= p[i];}
+    if (i != p.size()) {                                // n is 1 or prime
+        if (n != 1)
+            v.push_back(n);}
+    else
+        factor_rho(n, v);
+    std::sort(v.begin(), v.end());
+    return v;}
+
+/**
+ * x[i] = factor(b[i]) for each i in [0, e - b), on t threads
+ * the values are handed out in blocks of 64, so a few hard values
+ * do not leave the other threads idle
+ */
+template <typename RI1, typename RI2>
+void factor (RI1 b, RI1 e, RI2 x, unsigned t = std::thread::hardware_concurrency()) {
+    const std::ptrdiff_t n = e - b;
+    const std::ptrdiff_t g = 64;
+    t = std::max(1u, std::min<unsigned>(t, (n + g - 1) / g));
+    std::atomic<std::ptrdiff_t> k(0);
+    const auto f = [&] () {
+        for (std::ptrdiff_t i = k.fetch_add(g); i < n; i = k.fetch_add(g))
+            for (std::ptrdiff_t j = std::min(i + g, n); i != j; ++i)
+                x[i] = factor(b[i]);};
+    std::vector<std::thread> w;
+    for (unsigned i = 1; i < t; ++i)
+        w.push_back(std::thread(f));
+    f();
+    for (std::size_t i = 0; i != w.size(); ++i)
+        w[i].join();}
+
+#endif // Factor_h
@@ -0,0 +1,67 @@
+// ---------------
+// FactorBench.c++
+// ---------------
+
+#include <cstdint> // uint64_t
+#include <cstdio>  // printf
+#include <random>  // mt19937_64
+#include <thread>  // hardware_concurrency
+#include <vector>  // vector
+
+#include "Bench.h"
+#include "Factor.h"
+
+// trial division by every odd number
+std::vector<std::uint64_t> factor_trial (std::uint64_t n) {
+    std::vector<std::uint64_t> v;
+    for (; (n > 1) && ((n % 2) == 0); n /= 2)
+        v.push_back(2);
+    for (std::uint64_t d = 3; (d * d) <= n; d += 2)
+        for (; (n % d) == 0; n /= d)
+            v.push_back(d);
+    if (n > 1)
+        v.push_back(n);
+    return v;}
+
+// a product of two primes of k / 2 bits
+std::uint64_t semiprime (std::mt19937_64& g, int k) {
+    std::uint64_t p[2];
+    for (std::uint64_t& q : p)
+        do
+            q = (g() >> (64 - k / 2)) | (std::uint64_t(1) << (k / 2 - 1)) | 1;
+        while (!is_prime(q));
+    return p[0] * p[1];}
+
+int main () {
+    using namespace std;
+    mt19937_64 g(1);
+    const int n = 2000;
+
+    printf("%5s %14s %14s %14s\n", "bits", "trial, random", "rho, random", "rho, semiprime");
+    for (int k = 16; k <= 64; k += 8) {
+        vector<uint64_t> x(n);
+        vector<uint64_t> y(n);
+        for (int i = 0; i != n; ++i) {
+            x[i] = g() >> (64 - k);
+            y[i] = semiprime(g, k);}
+        const double t2 = bench([&] () {size_t c = 0; for (int i = 0; i != n; ++i) c += factor(x[i]).size(); do_not_optimize(c);}, 3);
+        const double t3 = bench([&] () {size_t c = 0; for (int i = 0; i != n; ++i) c += factor(y[i]).size(); do_not_optimize(c);}, 3);
+        if (k <= 40) {
+            const double t1 = bench([&] () {size_t c = 0; for (int i = 0; i != n; ++i) c += factor_trial(x[i]).size(); do_not_optimize(c);}, 1);
+            printf("%5d %12.2fus %12.2fus %12.2fus\n", k, t1 * 1e6 / n, t2 * 1e6 / n, t3 * 1e6 / n);}
+        else
+            printf("%5d %14s %12.2fus %12.2fus\n", k, "-", t2 * 1e6 / n, t3 * 1e6 / n);}
+
+    const int        m = 20000;
+    vector<uint64_t> x(m);
+    for (uint64_t& v : x)
+        v = g();
+    vector<vector<uint64_t>> y(m);
+    printf("\n%d random 64 bit values\n%8s %10s %10s\n", m, "threads", "time", "speedup");
+    double t1 = 0;
+    for (unsigned t = 1; t <= max(1u, thread::hardware_concurrency()); t *= 2) {
+        const double t2 = bench([&] () {factor(x.begin(), x.end(), y.begin(), t);}, 3);
+        if (t == 1)
+            t1 = t2;
+        printf("%8u %9.3fs %9.2fx\n", t, t2, t1 / t2);}
+    return 0;}
@@ -4,8 +4,9 @@
 
 // http://en.cppreference.com/w/cpp/algorithm/fill
 
-#include <algorithm>  // equal, fill
+#include <algorithm>  // count, equal, fill
 #include <cassert>    // assert
+#include <deque>      // deque
 #include <functional> // function
 #include <iostream>   // cout, endl
 #include <vector>     // vector
@@ -41,6 +42,32 @@ TEST_P(FillListFixture, test_2) {
     GetParam()(begin(x) + 1, end(x) - 1, v);
     ASSERT_TRUE(equal(begin(x), end(x), begin({0, 3, 3, 3, 3, 0})));}
 
+using FillDequeSignature = function<void (deque<int>::iterator, deque<int>::iterator, int)>;
+
+struct FillDequeFixture : TestWithParam<FillDequeSignature>
+    {};
+
+INSTANTIATE_TEST_CASE_P(
+    FillDequeInstantiation,
+    FillDequeFixture,
+    Values(
+           fill<deque<int>::iterator, int>,
+        my_fill<deque<int>::iterator, int>));
+
+TEST_P(FillDequeFixture, test_1) {
+    const int        v = 2;
+          deque<int> x(5);
+    GetParam()(begin(x) + 1, end(x) - 1, v);
+    ASSERT_TRUE(equal(begin(x), end(x), begin({0, 2, 2, 2, 0})));}
+
+TEST_P(FillDequeFixture, test_2) {
+    const int        v = 3;
+          deque<int> x(1000);
+    GetParam()(begin(x) + 1, end(x) - 1, v);
+    ASSERT_EQ(0, x.front());
+    ASSERT_EQ(0, x.back());
+    ASSERT_EQ(998, count(begin(x), end(x), v));}
+
 /*
 % Fill
 Running main() from gtest_main.cc
@@ -5,10 +5,58 @@
 #ifndef Fill_h
 #define Fill_h
 
+#include <cstddef> // size_t
+#include <cstring> // memcpy, memset
+
+#include "Dispatch.h"
+
 template <typename FI, typename T>
-void my_fill (FI b, FI e, const T& v) {
+void my_fill (FI b, FI e, const T& v);
+
+template <typename FI, typename T>
+void my_fill_loop (FI b, FI e, const T& v) {
     while (b != e) {
         *b = v;
         ++b;}}
 
+template <typename FI, typename T>
+void my_fill_kernel (FI b, FI e, const T& v, scalar_kernel) {
+    my_fill_loop(b, e, v);}
+
+template <typename FI, typename T>
+void my_fill_kernel (FI b, FI e, const T& v, contiguous_kernel) {
+    my_fill_loop(contiguous_iterator_traits<FI>::pointer(b), contiguous_iterator_traits<FI>::pointer(e), v);}
+
+// one byte values: the byte that v converts to, split across threads when large
+template <typename FI, typename T>
+void my_fill_kernel (FI b, FI e, const T& v, memset_kernel) {
+    typedef typename iterator_value<FI>::type value_type;
+    const std::size_t n = e - b;
+    if (n == 0)
+        return;
+    const value_type w = v;
+    unsigned char    c;
+    std::memcpy(&c, &w, 1);
+    unsigned char* p = reinterpret_cast<unsigned char*>(contiguous_iterator_traits<FI>::pointer(b));
+    parallel_blocks(n, dispatch_threads(n), [p, c] (std::size_t i, std::size_t j) {
+        std::memset(p + i, c, j - i);});}
+
+// segmented range: fill each segment with a contiguous kernel
+template <typename FI, typename T>
+void my_fill_kernel (FI b, FI e, const T& v, segmented_kernel) {
+    typedef segmented_iterator_traits<FI> traits;
+    typename traits::segment_iterator sb = traits::segment(b);
+    typename traits::segment_iterator se = traits::segment(e);
+    if (sb == se) {
+        my_fill(traits::local(b), traits::local(e), v);
+        return;}
+    my_fill(traits::local(b), traits::end(sb), v);
+    for (++sb; sb != se; ++sb)
+        my_fill(traits::begin(sb), traits::end(sb), v);
+    my_fill(traits::begin(se), traits::local(e), v);}
+
+template <typename FI, typename T>
+void my_fill (FI b, FI e, const T& v) {
+    my_fill_kernel(b, e, v, typename fill_kernel<FI, T>::type());}
+
 #endif // Fill_h
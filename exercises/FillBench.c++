@@ -0,0 +1,26 @@
+// -------------
+// FillBench.c++
+// -------------
+
+#include <algorithm> // fill
+#include <cstdio>    // printf
+#include <cstdlib>   // atoi
+#include <deque>     // deque
+
+#include "Bench.h"
+#include "Fill.h"
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const int m = (argc > 1) ? atoi(argv[1]) : (1 << 22);
+
+    printf("deque<int>\n");
+    printf("%10s %12s %12s %12s\n", "n", "fill", "my_fill_loop", "my_fill");
+    for (int n = 1 << 8; n <= m; n <<= 2) {
+        deque<int> x(n);
+        const int r = (1 << 24) / n + 1;
+        const double t1 = bench([&] () {for (int i = 0; i != r; ++i) {        fill(begin(x), end(x), i); do_not_optimize(x.back());}});
+        const double t2 = bench([&] () {for (int i = 0; i != r; ++i) {my_fill_loop(begin(x), end(x), i); do_not_optimize(x.back());}});
+        const double t3 = bench([&] () {for (int i = 0; i != r; ++i) {     my_fill(begin(x), end(x), i); do_not_optimize(x.back());}});
+        printf("%10d %10.3fns %10.3fns %10.3fns\n", n, t1 * 1e9 / r / n, t2 * 1e9 / r / n, t3 * 1e9 / r / n);}
+    return 0;}
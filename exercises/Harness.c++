@@ -0,0 +1,67 @@
+// -----------
+// Harness.c++
+// -----------
+
+#include <sstream> // ostringstream
+#include <vector>  // vector
+
+#include "gtest/gtest.h"
+
+#include "Harness.h"
+
+using namespace std;
+
+TEST(HarnessFixture, median_1) {
+    ASSERT_EQ(0, median({}));
+    ASSERT_EQ(3, median({5, 3, 1}));
+    ASSERT_EQ(2.5, median({4, 1, 3, 2}));}
+
+TEST(HarnessFixture, stats_1) {
+    const Stats s = stats({1, 2, 3, 4, 100});
+    ASSERT_EQ(5, s.n);
+    ASSERT_EQ(1, s.min);
+    ASSERT_EQ(3, s.median);
+    ASSERT_EQ(1, s.mad);}
+
+TEST(HarnessFixture, measure_1) {
+    int i = 0;
+    const Stats s = measure([&] () {++i;}, 7, 3);
+    ASSERT_EQ(10, i);
+    ASSERT_EQ(7, s.n);
+    ASSERT_LE(s.min, s.median);}
+
+TEST(HarnessFixture, measure_per_1) {
+    int i = 0;
+    const Stats s = measure_per([&] () {++i;}, 100, 4, 5, 1);
+    ASSERT_EQ(24, i);
+    ASSERT_EQ(5, s.n);}
+
+TEST(HarnessFixture, report_1) {
+    Report x;
+    x.add("my_copy", "deque", 1024, Stats {1, 2.5, 0.25, 11});
+    ostringstream out;
+    x.write_csv(out);
+    ASSERT_EQ(
+        "algorithm,kind,n,runs,min_ns,median_ns,mad_ns\n"
+        "my_copy,deque,1024,11,1.0000,2.5000,0.2500\n",
+        out.str());}
+
+TEST(HarnessFixture, report_2) {
+    Report x;
+    x.add("copy",      "list", 4, Stats {1, 2, 0, 3});
+    x.add("my_\"copy", "list", 4, Stats {1, 2, 0, 3});
+    ostringstream out;
+    x.write_json(out);
+    ASSERT_EQ(
+        "[\n"
+        "  {\"algorithm\": \"copy\", \"kind\": \"list\", \"n\": 4, \"runs\": 3, \"min_ns\": 1.0000, \"median_ns\": 2.0000, \"mad_ns\": 0.0000},\n"
+        "  {\"algorithm\": \"my_\\\"copy\", \"kind\": \"list\", \"n\": 4, \"runs\": 3, \"min_ns\": 1.0000, \"median_ns\": 2.0000, \"mad_ns\": 0.0000}\n"
+        "]\n",
+        out.str());}
+
+TEST(HarnessFixture, report_3) {
+    Report x;
+    ostringstream out;
+    x.write_json(out);
+    ASSERT_EQ("[\n]\n", out.str());
+    ASSERT_TRUE(x.samples().empty());}
@@ -0,0 +1,112 @@
+// ---------
+// Harness.h
+// ---------
+
+#ifndef Harness_h
+#define Harness_h
+
+#include <cstddef> // size_t
+#include <cstdio>  // snprintf
+#include <ostream> // endl, ostream
+#include <string>  // string
+#include <vector>  // vector
+
+#include "Bench.h"
+
+/*
+collects the samples of a sweep, one per algorithm, iterator kind, and size,
+and writes them as a table to read, or as CSV or JSON to diff against an earlier run
+
+the times are in nanoseconds per element
+*/
+
+// -----------
+// measure_per
+// -----------
+
+/*
+runs f r times per timed run, so that a run of a small n is long enough to time,
+and scales the statistics to nanoseconds per element
+*/
+
+template <typename F>
+Stats measure_per (F f, std::size_t n, int r, int k = 11, int w = 2) {
+    Stats s = measure([&] () {for (int i = 0; i != r; ++i) f();}, k, w);
+    const double d = 1e9 / (static_cast<double>(r) * (n == 0 ? 1 : n));
+    s.min    *= d;
+    s.median *= d;
+    s.mad    *= d;
+    return s;}
+
+// ------
+// Sample
+// ------
+
+struct Sample {
+    std::string algorithm;
+    std::string kind;
+    std::size_t n;
+    Stats       s;};
+
+// ------
+// Report
+// ------
+
+class Report {
+    private:
+        std::vector<Sample> _x;
+
+        static std::string number (double v) {
+            char b[32];
+            std::snprintf(b, sizeof(b), "%.4f", v);
+            return b;}
+
+        static std::string quote (const std::string& s) {
+            std::string t = "\"";
+            for (char c : s) {
+                if ((c == '"') || (c == '\\'))
+                    t += '\\';
+                t += c;}
+            return t + '"';}
+
+    public:
+        Report () :
+                _x ()
+            {}
+
+        void add (const std::string& a, const std::string& k, std::size_t n, const Stats& s) {
+            _x.push_back(Sample {a, k, n, s});}
+
+        const std::vector<Sample>& samples () const {
+            return _x;}
+
+        void write_table (std::ostream& out) const {
+            char b[128];
+            std::snprintf(b, sizeof(b), "%-16s %-8s %10s %12s %12s %12s", "algorithm", "kind", "n", "min", "median", "mad");
+            out << b << std::endl;
+            for (const Sample& x : _x) {
+                std::snprintf(b, sizeof(b), "%-16s %-8s %10zu %10.3fns %10.3fns %10.3fns",
+                    x.algorithm.c_str(), x.kind.c_str(), x.n, x.s.min, x.s.median, x.s.mad);
+                out << b << std::endl;}}
+
+        void write_csv (std::ostream& out) const {
+            out << "algorithm,kind,n,runs,min_ns,median_ns,mad_ns" << std::endl;
+            for (const Sample& x : _x)
+                out << x.algorithm << ','  << x.kind << ',' << x.n << ',' << x.s.n << ','
+                    << number(x.s.min) << ',' << number(x.s.median) << ',' << number(x.s.mad) << std::endl;}
+
+        void write_json (std::ostream& out) const {
+            out << '[';
+            for (std::size_t i = 0; i != _x.size(); ++i) {
+                const Sample& x = _x[i];
+                out << ((i == 0) ? "" : ",") << std::endl
+                    << "  {\"algorithm\": " << quote(x.algorithm)
+                    << ", \"kind\": "       << quote(x.kind)
+                    << ", \"n\": "          << x.n
+                    << ", \"runs\": "       << x.s.n
+                    << ", \"min_ns\": "     << number(x.s.min)
+                    << ", \"median_ns\": "  << number(x.s.median)
+                    << ", \"mad_ns\": "     << number(x.s.mad) << '}';}
+            out << std::endl << ']' << std::endl;}};
+
+#endif // Harness_h
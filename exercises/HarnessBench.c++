@@ -0,0 +1,111 @@
+// ----------------
+// HarnessBench.c++
+// ----------------
+
+/*
+HarnessBench.app [m] [table | csv | json]
+sweeps n from 2^10 to m by 4x over raw pointers, vectors, deques, and lists,
+std against my_ for copy, fill, equal, and all_of,
+the rmse variants against each other,
+and is_prime against is_prime_miller_rabin over [0, n)
+*/
+
+#include <algorithm> // all_of, copy, equal, fill, max
+#include <cstdint>   // uint64_t
+#include <cstdlib>   // atoi
+#include <cstring>   // strcmp
+#include <deque>     // deque
+#include <iostream>  // cout
+#include <list>      // list
+#include <vector>    // vector
+
+#include "AllOf.h"
+#include "Copy.h"
+#include "Equal.h"
+#include "Fill.h"
+#include "Harness.h"
+#include "IsPrime3.h"
+#include "RMSE.h"
+
+template <typename I, typename O>
+void sweep (Report& z, const char* k, std::size_t n, int r, I b, I e, I c, O x, O y) {
+    using namespace std;
+    const auto f = [] (int v) -> bool {return v >= 0;};
+    z.add("copy",      k, n, measure_per([&] () {do_not_optimize(     copy(b, e, x));},              n, r));
+    z.add("my_copy",   k, n, measure_per([&] () {do_not_optimize(  my_copy(b, e, x));},              n, r));
+    z.add("fill",      k, n, measure_per([&] () {                     fill(x, y, 2); do_not_optimize(*x);}, n, r));
+    z.add("my_fill",   k, n, measure_per([&] () {                  my_fill(x, y, 2); do_not_optimize(*x);}, n, r));
+    z.add("equal",     k, n, measure_per([&] () {do_not_optimize(    equal(b, e, c));},              n, r));
+    z.add("my_equal",  k, n, measure_per([&] () {do_not_optimize( my_equal(b, e, c));},              n, r));
+    z.add("all_of",    k, n, measure_per([&] () {do_not_optimize(   all_of(b, e, f));},              n, r));
+    z.add("my_all_of", k, n, measure_per([&] () {do_not_optimize(my_all_of(b, e, f));},              n, r));}
+
+template <typename I>
+void sweep_rmse (Report& z, const char* k, std::size_t n, int r, I b, I e, I c) {
+    z.add("rmse_while",                k, n, measure_per([&] () {do_not_optimize(               rmse_while(b, e, c, 0.0));}, n, r));
+    z.add("rmse_transform_accumulate", k, n, measure_per([&] () {do_not_optimize(rmse_transform_accumulate(b, e, c, 0.0));}, n, r));
+    z.add("rmse_fused",                k, n, measure_per([&] () {do_not_optimize(               rmse_fused(b, e, c, 0.0));}, n, r));
+    z.add("rmse_view",                 k, n, measure_per([&] () {do_not_optimize(                rmse_view(b, e, c, 0.0));}, n, r));}
+
+void sweep_is_prime (Report& z, std::size_t n, int r) {
+    z.add("is_prime", "range", n, measure_per([&] () {
+        int p = 0;
+        for (std::uint64_t i = 0; i != n; ++i)
+            p += is_prime(i);
+        do_not_optimize(p);}, n, r));
+    z.add("is_prime_mr", "range", n, measure_per([&] () {
+        int p = 0;
+        for (std::uint64_t i = 0; i != n; ++i)
+            p += is_prime_miller_rabin(i);
+        do_not_optimize(p);}, n, r));}
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const int         m = (argc > 1) ? atoi(argv[1]) : (1 << 20);
+    const char* const o = (argc > 2) ? argv[2]       : "table";
+
+    Report z;
+    for (int n = 1 << 10; n <= m; n <<= 2) {
+        const int r = max(1, (1 << 20) / n);
+        {
+        vector<int> x(n, 1);
+        vector<int> y(n, 1);
+        vector<int> w(n);
+        sweep(z, "pointer", n, r, x.data(), x.data() + n, y.data(), w.data(), w.data() + n);
+        sweep(z, "vector",  n, r, x.cbegin(), x.cend(), y.cbegin(), begin(w), end(w));
+        }
+        {
+        const deque<int> x(n, 1);
+        const deque<int> y(n, 1);
+              deque<int> w(n);
+        sweep(z, "deque", n, r, begin(x), end(x), begin(y), begin(w), end(w));
+        }
+        {
+        const list<int> x(n, 1);
+        const list<int> y(n, 1);
+              list<int> w(n);
+        sweep(z, "list", n, r, begin(x), end(x), begin(y), begin(w), end(w));
+        }
+        {
+        vector<double> x(n);
+        vector<double> y(n);
+        for (int i = 0; i != n; ++i) {
+            x[i] = i % 1000;
+            y[i] = (i + 1) % 1000;}
+        const deque<double> dx(begin(x), end(x));
+        const deque<double> dy(begin(y), end(y));
+        const list<double>  lx(begin(x), end(x));
+        const list<double>  ly(begin(y), end(y));
+        sweep_rmse(z, "pointer", n, r, x.data(), x.data() + n, y.data());
+        sweep_rmse(z, "deque",   n, r, begin(dx), end(dx), begin(dy));
+        sweep_rmse(z, "list",    n, r, begin(lx), end(lx), begin(ly));
+        }
+        sweep_is_prime(z, n, r);}
+
+    if (strcmp(o, "csv") == 0)
+        z.write_csv(cout);
+    else if (strcmp(o, "json") == 0)
+        z.write_json(cout);
+    else
+        z.write_table(cout);
+    return 0;}
@@ -4,6 +4,10 @@
 
 // http://en.cppreference.com/w/cpp/language/operator_incdec
 
+#include <atomic> // atomic
+#include <thread> // thread
+#include <vector> // vector
+
 #include "gtest/gtest.h"
 
 #include "Incr.h"
@@ -30,3 +34,26 @@ TEST(IncrFixture, test_4) {
     int i = 2;
 //  post_incr(post_incr(i)); // error: no matching function for call to 'post_incr'
     ASSERT_EQ(2, i);}
+
+TEST(IncrFixture, test_5) {
+    std::atomic<int> i(2);
+    int j = pre_incr(i);
+    ASSERT_EQ(3, i);
+    ASSERT_EQ(3, j);
+    j = post_incr(i);
+    ASSERT_EQ(4, i);
+    ASSERT_EQ(3, j);}
+
+TEST(IncrFixture, test_6) {
+    std::atomic<long>        i(0);
+    std::vector<char>        x(40000, 0);
+    std::vector<std::thread> v;
+    for (int k = 0; k != 4; ++k)
+        v.push_back(std::thread([&i, &x] () {
+            for (int n = 0; n != 10000; ++n)
+                ++x[post_incr(i, std::memory_order_relaxed)];}));
+    for (std::thread& t : v)
+        t.join();
+    ASSERT_EQ(40000, i);
+    for (char c : x)
+        ASSERT_EQ(1, c);}
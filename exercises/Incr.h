@@ -5,12 +5,29 @@
 #ifndef Incr_h
 #define Incr_h
 
-int& pre_incr (int& r) {
+#include <atomic> // atomic, memory_order
+
+inline int& pre_incr (int& r) {
     return r += 1;}
 
-int post_incr (int& r) {
+inline int post_incr (int& r) {
     int v = r;
     r += 1;
     return v;}
 
+/*
+the same values for a counter shared between threads
+one read-modify-write, so no two threads see the same value
+pre_incr returns the new value, not a reference, another thread may
+already have moved the atomic past it
+*/
+
+template <typename T>
+T pre_incr (std::atomic<T>& r, std::memory_order m = std::memory_order_seq_cst) {
+    return r.fetch_add(1, m) + 1;}
+
+template <typename T>
+T post_incr (std::atomic<T>& r, std::memory_order m = std::memory_order_seq_cst) {
+    return r.fetch_add(1, m);}
+
 #endif // Incr_h
@@ -0,0 +1,34 @@
+// -------------
+// IndexList.c++
+// -------------
+
+// http://en.cppreference.com/w/cpp/utility/integer_sequence
+
+#include <array>       // array
+#include <cstddef>     // size_t
+#include <type_traits> // is_same
+
+#include "gtest/gtest.h"
+
+#include "IndexList.h"
+
+using namespace std;
+
+template <typename T, size_t N, size_t... I>
+array<T, N> reversed (const array<T, N>& a, index_list<I...>) {
+    return {{a[N - 1 - I]...}};}
+
+TEST(IndexListFixture, test_1) {
+    static_assert(is_same<make_index_list<0>::type, index_list<>>::value,           "");
+    static_assert(is_same<make_index_list<1>::type, index_list<0>>::value,          "");
+    static_assert(is_same<make_index_list<5>::type, index_list<0, 1, 2, 3, 4>>::value, "");
+    ASSERT_EQ(0u, make_index_list<0>::size());}
+
+TEST(IndexListFixture, test_2) {
+    ASSERT_EQ(1000u, make_index_list<1000>::size());}
+
+TEST(IndexListFixture, test_3) {
+    const array<int, 4> a = {{2, 3, 5, 7}};
+    const array<int, 4> b = reversed(a, make_index_list<4>());
+    const array<int, 4> c = {{7, 5, 3, 2}};
+    ASSERT_EQ(c, b);}
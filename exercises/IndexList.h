@@ -0,0 +1,58 @@
+// -----------
+// IndexList.h
+// -----------
+
+#ifndef IndexList_h
+#define IndexList_h
+
+#include <cstddef> // size_t
+
+/*
+a compile-time list of indices, 0, 1, ..., N - 1, for expanding a pack
+over an array or a tuple, like std::index_sequence in C++14
+make_index_list<N> splits N in half, so the instantiation depth is log N
+*/
+
+// ----------
+// index_list
+// ----------
+
+template <std::size_t... I>
+struct index_list {
+    typedef index_list type;
+
+    static constexpr std::size_t size () {
+        return sizeof...(I);}};
+
+// -----------------
+// concat_index_list
+// -----------------
+
+template <typename L1, typename L2>
+struct concat_index_list;
+
+template <std::size_t... I, std::size_t... J>
+struct concat_index_list<index_list<I...>, index_list<J...>> :
+        index_list<I..., (sizeof...(I) + J)...>
+    {};
+
+// ---------------
+// make_index_list
+// ---------------
+
+template <std::size_t N>
+struct make_index_list :
+        concat_index_list<typename make_index_list<N / 2>::type, typename make_index_list<N - N / 2>::type>::type
+    {};
+
+template <>
+struct make_index_list<0> :
+        index_list<>
+    {};
+
+template <>
+struct make_index_list<1> :
+        index_list<0>
+    {};
+
+#endif // IndexList_h
@@ -0,0 +1,122 @@
+// -------------------
+// IntegerIterator.c++
+// -------------------
+
+// http://en.cppreference.com/w/cpp/iterator/istream_iterator
+
+#include <algorithm> // copy, equal
+#include <iterator>  // back_inserter, istream_iterator
+#include <limits>    // numeric_limits
+#include <random>    // mt19937_64
+#include <sstream>   // istringstream, ostringstream
+#include <string>    // string
+#include <vector>    // vector
+
+#include "gtest/gtest.h"
+
+#include "Copy.h"
+#include "IntegerIterator.h"
+
+using namespace std;
+
+TEST(IntegerIteratorFixture, test_1) {
+    istringstream sin("2 3 4");
+    Integer_Iterator<int> b(sin);
+    Integer_Iterator<int> e;
+    ASSERT_NE(b, e);
+    ASSERT_EQ(2, *b);
+    ++b;
+    ASSERT_EQ(3, *b);
+    Integer_Iterator<int> x = b++;
+    ASSERT_EQ(3, *x);
+    ASSERT_EQ(4, *b);
+    ++b;
+    ASSERT_EQ(b, e);
+    ASSERT_TRUE(sin.eof());
+    ASSERT_TRUE(sin.fail());}
+
+TEST(IntegerIteratorFixture, test_2) {
+    istringstream sin("  \t-12\n+7\r\n0 -0   2147483647 -2147483648\n\n");
+    vector<int> x;
+    my_copy(Integer_Iterator<int>(sin), Integer_Iterator<int>(), back_inserter(x));
+    ASSERT_EQ(vector<int>({-12, 7, 0, 0, 2147483647, -2147483647 - 1}), x);
+    ASSERT_TRUE(sin.eof());}
+
+TEST(IntegerIteratorFixture, test_3) {
+    istringstream sin("");
+    ASSERT_EQ(Integer_Iterator<int>(sin), Integer_Iterator<int>());
+    ASSERT_TRUE(sin.eof());
+    ASSERT_TRUE(sin.fail());}
+
+TEST(IntegerIteratorFixture, test_4) {
+    istringstream sin("1 2 x 3");
+    vector<int> x;
+    my_copy(Integer_Iterator<int>(sin), Integer_Iterator<int>(), back_inserter(x));
+    ASSERT_EQ(vector<int>({1, 2}), x);
+    ASSERT_TRUE(sin.fail());
+    sin.clear();
+    string s;
+    sin >> s;
+    ASSERT_EQ("x", s);}
+
+TEST(IntegerIteratorFixture, test_5) {
+    istringstream sin("127 128");
+    vector<signed char> x;
+    my_copy(Integer_Iterator<signed char>(sin), Integer_Iterator<signed char>(), back_inserter(x));
+    ASSERT_EQ(1u, x.size());
+    ASSERT_EQ(127, x[0]);
+    ASSERT_TRUE(sin.fail());}
+
+TEST(IntegerIteratorFixture, test_6) {
+    istringstream sin("12 34;56");
+    Integer_Iterator<int> b(sin);
+    ++b;
+    ASSERT_EQ(34, *b);
+    ASSERT_EQ(';', sin.peek());}
+
+TEST(IntegerIteratorFixture, test_7) {
+    mt19937_64 g(1);
+    ostringstream sout;
+    for (int i = 0; i != 10000; ++i)
+        sout << static_cast<long long>(g()) << ((i % 7) ? " " : "\n");
+    istringstream s1(sout.str());
+    istringstream s2(sout.str());
+    vector<long long> x;
+    vector<long long> y;
+    copy(istream_iterator<long long>(s1), istream_iterator<long long>(), back_inserter(x));
+    my_copy(Integer_Iterator<long long>(s2), Integer_Iterator<long long>(), back_inserter(y));
+    ASSERT_EQ(10000u, y.size());
+    ASSERT_EQ(x, y);}
+
+TEST(IntegerIteratorFixture, test_8) {
+    istringstream sin("18446744073709551615 18446744073709551616");
+    vector<unsigned long long> x;
+    my_copy(Integer_Iterator<unsigned long long>(sin), Integer_Iterator<unsigned long long>(), back_inserter(x));
+    ASSERT_EQ(vector<unsigned long long>({numeric_limits<unsigned long long>::max()}), x);
+    ASSERT_TRUE(sin.fail());}
+
+TEST(IntegerIteratorFixture, test_9) {
+    for (const char* s : {"", "  \n", "12 34 ", "12 34", "12 -", "12 +"}) {
+        istringstream s1(s);
+        istringstream s2(s);
+        vector<int> x;
+        vector<int> y;
+        copy(istream_iterator<int>(s1), istream_iterator<int>(), back_inserter(x));
+        my_copy(Integer_Iterator<int>(s2), Integer_Iterator<int>(), back_inserter(y));
+        ASSERT_EQ(x, y) << s;
+        ASSERT_EQ(s1.rdstate(), s2.rdstate()) << s;
+        ASSERT_TRUE(s2.fail()) << s;}}
+
+TEST(IntegerIteratorFixture, test_10) {
+    for (const char* s : {"9999999999999999999", "9223372036854775808", "-9223372036854775809"}) {
+        istringstream sin(s);
+        vector<long long> x;
+        my_copy(Integer_Iterator<long long>(sin), Integer_Iterator<long long>(), back_inserter(x));
+        ASSERT_TRUE(x.empty()) << s;
+        ASSERT_TRUE(sin.fail()) << s;}}
+
+TEST(IntegerIteratorFixture, test_11) {
+    istringstream sin("9223372036854775807 -9223372036854775808");
+    vector<long long> x;
+    my_copy(Integer_Iterator<long long>(sin), Integer_Iterator<long long>(), back_inserter(x));
+    ASSERT_EQ(vector<long long>({numeric_limits<long long>::max(), numeric_limits<long long>::min()}), x);}
@@ -0,0 +1,124 @@
+// -----------------
+// IntegerIterator.h
+// -----------------
+
+#ifndef IntegerIterator_h
+#define IntegerIterator_h
+
+#include <istream>     // istream
+#include <iterator>    // input_iterator_tag, iterator
+#include <limits>      // numeric_limits
+#include <streambuf>   // streambuf
+#include <string>      // char_traits
+#include <type_traits> // is_integral, is_signed, make_unsigned
+
+/*
+an istream_iterator<T> for integral T that skips the formatted extraction
+istream_iterator calls operator >>, which builds a sentry, consults the
+locale and goes through num_get for every element
+this iterator reads the characters straight from the stream's buffer
+with sgetc and sbumpc, which are inline and only call a virtual when
+the get area runs dry, so the buffer is refilled in bulk by the stream
+
+it accepts what operator >> accepts in the "C" locale, leading white
+space, an optional sign and decimal digits, and it stops, like
+istream_iterator, when no value can be read, with failbit set,
+and eofbit too, if that is because the stream ended,
+so a loop on the stream's state sees no value past the last one
+it consumes nothing past the last digit, so the stream can be used after
+
+with cin, call ios_base::sync_with_stdio(false) first, otherwise cin's
+buffer is unbuffered and every character is a virtual call
+*/
+
+// ----------------
+// Integer_Iterator
+// ----------------
+
+template <typename T>
+class Integer_Iterator : public std::iterator<std::input_iterator_tag, T, std::ptrdiff_t, const T*, const T&> {
+    static_assert(std::is_integral<T>::value, "T must be an integral type");
+
+    friend bool operator == (const Integer_Iterator& lhs, const Integer_Iterator& rhs) {
+        return (lhs._s == rhs._s);}
+
+    friend bool operator != (const Integer_Iterator& lhs, const Integer_Iterator& rhs) {
+        return !(lhs == rhs);}
+
+    private:
+        typedef std::char_traits<char>                 traits;
+        typedef typename std::make_unsigned<T>::type   U;
+
+        std::istream* _s;
+        T             _v;
+
+        static bool is_space (int c) {
+            return (c == ' ') || ((c >= '\t') && (c <= '\r'));}
+
+        void fail (std::ios_base::iostate f) {
+            _s->setstate(f);
+            _s = nullptr;}
+
+        void read () {
+            std::streambuf* const b = _s->rdbuf();
+            int c = b->sgetc();
+            while (is_space(c))
+                c = b->snextc();
+            if (c == traits::eof())
+                return fail(std::ios_base::eofbit | std::ios_base::failbit);
+            const bool n = (c == '-');                 // an unsigned T wraps, like operator >>
+            if ((c == '-') || (c == '+'))
+                c = b->snextc();
+            if (c == traits::eof())
+                return fail(std::ios_base::eofbit | std::ios_base::failbit);
+            if ((c < '0') || (c > '9'))
+                return fail(std::ios_base::failbit);
+            const U m = (std::is_signed<T>::value && n) ?
+                static_cast<U>(std::numeric_limits<T>::max()) + 1 :
+                static_cast<U>(std::numeric_limits<T>::max());
+            U   v = 0;
+            int k = std::numeric_limits<T>::digits10;   // digits that cannot overflow T
+            do {
+                const U d = static_cast<U>(c - '0');
+                if ((--k < 0) && (v > (m - d) / 10))
+                    return fail(std::ios_base::failbit);
+                v = v * 10 + d;
+                c = b->snextc();}
+            while ((c >= '0') && (c <= '9'));
+            if (c == traits::eof())
+                _s->setstate(std::ios_base::eofbit);
+            _v = n ? static_cast<T>(0 - v) : static_cast<T>(v);}
+
+    public:
+        /**
+         * the end of every stream
+         */
+        Integer_Iterator () :
+                _s (nullptr),
+                _v ()
+            {}
+
+        explicit Integer_Iterator (std::istream& s) :
+                _s (&s),
+                _v () {
+            if (!*_s)
+                _s = nullptr;
+            else
+                read();}
+
+        const T& operator * () const {
+            return _v;}
+
+        const T* operator -> () const {
+            return &_v;}
+
+        Integer_Iterator& operator ++ () {
+            read();
+            return *this;}
+
+        Integer_Iterator operator ++ (int) {
+            Integer_Iterator x = *this;
+            ++*this;
+            return x;}};
+
+#endif // IntegerIterator_h
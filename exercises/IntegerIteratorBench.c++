@@ -0,0 +1,70 @@
+// ------------------------
+// IntegerIteratorBench.c++
+// ------------------------
+
+#include <algorithm> // copy
+#include <cstdio>    // printf, remove
+#include <cstdlib>   // atol
+#include <fstream>   // ifstream, ofstream
+#include <iterator>  // back_inserter, istream_iterator
+#include <random>    // mt19937
+#include <string>    // string
+#include <vector>    // vector
+
+#include "Bench.h"
+#include "Copy.h"
+#include "IntegerIterator.h"
+
+/*
+IntegerIteratorBench [n [file]]
+with a file name, times that file, otherwise writes n random ints, 100M by default
+*/
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const long n = (argc > 1) ? atol(argv[1]) : 100000000L;
+    string f = "IntegerIteratorBench.txt";
+    if (argc > 2)
+        f = argv[2];
+    else {
+        mt19937 g(1);
+        string  s;
+        char    a[16];
+        for (long i = 0; i != n; ++i) {
+            s.append(a, snprintf(a, sizeof(a), "%d", static_cast<int>(g() % 2000000000) - 1000000000));
+            s += ((i % 10) == 9) ? '\n' : ' ';}
+        ofstream(f).write(s.data(), s.size());}
+
+    long m = 0;
+    const double t1 = bench([&] () {
+        ifstream    r(f);
+        vector<int> x;
+        copy(istream_iterator<int>(r), istream_iterator<int>(), back_inserter(x));
+        m = x.size();}, 3);
+    const double t2 = bench([&] () {
+        ifstream    r(f);
+        vector<int> x;
+        my_copy(Integer_Iterator<int>(r), Integer_Iterator<int>(), back_inserter(x));
+        m = x.size();}, 3);
+    const double t3 = bench([&] () {
+        ifstream r(f);
+        long     s = 0;
+        for (istream_iterator<int> b(r), e; b != e; ++b)
+            s += *b;
+        do_not_optimize(s);}, 3);
+    const double t4 = bench([&] () {
+        ifstream r(f);
+        long     s = 0;
+        for (Integer_Iterator<int> b(r), e; b != e; ++b)
+            s += *b;
+        do_not_optimize(s);}, 3);
+    const double b = ifstream(f, ios::ate).tellg() / 1e6;
+    printf("%ld ints, %.0f MB\n", m, b);
+    printf("%32s %10s %10s %10s\n", "", "time", "ns/int", "MB/s");
+    printf("%32s %9.3fs %10.2f %10.1f\n", "copy(istream_iterator)",    t1, t1 * 1e9 / m, b / t1);
+    printf("%32s %9.3fs %10.2f %10.1f\n", "my_copy(Integer_Iterator)", t2, t2 * 1e9 / m, b / t2);
+    printf("%32s %9.3fs %10.2f %10.1f\n", "sum, istream_iterator",     t3, t3 * 1e9 / m, b / t3);
+    printf("%32s %9.3fs %10.2f %10.1f\n", "sum, Integer_Iterator",     t4, t4 * 1e9 / m, b / t4);
+    if (argc <= 2)
+        remove(f.c_str());
+    return 0;}
@@ -0,0 +1,93 @@
+// ----------
+// Intern.c++
+// ----------
+
+#include <cstring>       // strcmp
+#include <string>        // string, to_string
+#include <thread>        // thread
+#include <unordered_set> // unordered_set
+#include <vector>        // vector
+
+#include "gtest/gtest.h"
+
+#include "Intern.h"
+
+using namespace std;
+
+TEST(InternFixture, test_1) {
+    Intern_Pool<> x;
+    const string a = "abc";
+    const string b = string("ab") + "c";
+    ASSERT_NE(a.data(), b.data());
+    ASSERT_EQ(x.intern(a), x.intern(b));
+    ASSERT_EQ(x.intern(a).c_str(), x.intern("abc").c_str());
+    ASSERT_NE(x.intern("abc"), x.intern("abd"));
+    ASSERT_EQ(2u, x.size());}
+
+TEST(InternFixture, test_2) {
+    Intern_Pool<> x;
+    const Symbol s = x.intern("identifier");
+    ASSERT_EQ(0, strcmp("identifier", s.c_str()));
+    ASSERT_EQ(10u, s.size());
+    ASSERT_EQ("identifier", s.str());
+    ASSERT_EQ(intern_hash("identifier", 10), s.hash());}
+
+TEST(InternFixture, test_3) {
+    Intern_Pool<> x;
+    const string a("a\0b", 3);
+    const string b("a\0c", 3);
+    ASSERT_NE(x.intern(a), x.intern(b));
+    ASSERT_EQ(3u, x.intern(a).size());
+    ASSERT_NE(x.intern(a), x.intern("a"));}
+
+TEST(InternFixture, test_4) {
+    Intern_Pool<> x;
+    Intern_Pool<> y;
+    ASSERT_EQ(Symbol(), x.intern(""));
+    ASSERT_EQ(x.intern(""), y.intern(string()));
+    ASSERT_EQ(0u, Symbol().size());
+    ASSERT_EQ(0, strcmp("", Symbol().c_str()));
+    ASSERT_EQ(0u, x.size());}
+
+TEST(InternFixture, test_5) {
+    Intern_Pool<4> x;
+    vector<Symbol> v;
+    for (int i = 0; i != 100000; ++i)
+        v.push_back(x.intern("s" + to_string(i)));
+    ASSERT_EQ(100000u, x.size());
+    for (int i = 0; i != 100000; ++i) {
+        ASSERT_EQ(v[i], x.intern("s" + to_string(i)));
+        ASSERT_EQ("s" + to_string(i), v[i].str());}}
+
+TEST(InternFixture, test_6) {
+    Intern_Pool<> x;
+    const string s(100000, 'z');
+    const Symbol a = x.intern(s);
+    ASSERT_EQ(s, a.str());
+    ASSERT_EQ(a, x.intern(s));}
+
+TEST(InternFixture, test_7) {
+    Intern_Pool<8>         x;
+    const int              t = 4;
+    const int              n = 20000;
+    vector<vector<Symbol>> v(t);
+    vector<thread>         w;
+    for (int i = 0; i != t; ++i)
+        w.emplace_back([&x, &v, i] () {
+            for (int j = 0; j != n; ++j)
+                v[i].push_back(x.intern(to_string((j * 7 + i) % n)));});
+    for (thread& th : w)
+        th.join();
+    ASSERT_EQ(static_cast<size_t>(n), x.size());
+    for (int i = 0; i != t; ++i)
+        for (int j = 0; j != n; ++j)
+            ASSERT_EQ(x.intern(to_string((j * 7 + i) % n)), v[i][j]);}
+
+TEST(InternFixture, test_8) {
+    Intern_Pool<> x;
+    unordered_set<Symbol> s;
+    s.insert(x.intern("a"));
+    s.insert(x.intern("b"));
+    s.insert(x.intern(string("a")));
+    ASSERT_EQ(2u, s.size());
+    ASSERT_EQ(intern("global"), intern(string("glob") + "al"));}
@@ -0,0 +1,307 @@
+// --------
+// Intern.h
+// --------
+
+#ifndef Intern_h
+#define Intern_h
+
+#include <algorithm>  // max
+#include <atomic>     // atomic, memory_order_acquire, memory_order_relaxed, memory_order_release
+#include <cstddef>    // size_t
+#include <cstdint>    // uint64_t
+#include <cstring>    // memcmp, memcpy, strlen
+#include <functional> // hash
+#include <memory>     // unique_ptr
+#include <mutex>      // lock_guard, mutex
+#include <string>     // string
+#include <vector>     // vector
+
+/*
+a string literal is stored once, so two equal literals have the same address (Cache.c++)
+an interning pool does the same for strings made at run time
+intern returns a Symbol, a pointer to the one copy of the string in the pool,
+so equality is one pointer compare and the hash is computed once, when the string is interned
+
+the strings live in an arena and never move or die before the pool,
+so a Symbol stays valid for the life of its pool
+two Symbols are only comparable if they come from the same pool
+
+the pool is split into N shards by the hash, each with its own lock, table, and arena
+a lookup of a string that is already interned takes no lock,
+it probes the shard's table with acquire loads,
+an insert takes the shard's lock, looks again, and publishes the string with a release store
+a table that grows is retired, not freed, so a lookup that is still probing it stays safe
+*/
+
+// -----------
+// intern_hash
+// -----------
+
+/**
+ * eight bytes at a time, each word multiplied in, with a final mix
+ * so that the low bits, which pick the slot, and the high bits, which pick the shard, are both usable
+ */
+inline std::uint64_t intern_hash (const char* s, std::size_t n) {
+    const std::uint64_t k = 0x9e3779b97f4a7c15ull;
+    std::uint64_t       h = n * k;
+    std::uint64_t       w;
+    for (; n >= 8; s += 8, n -= 8) {
+        std::memcpy(&w, s, 8);
+        h = (h ^ w) * k;
+        h ^= h >> 29;}
+    if (n != 0) {
+        w = 0;
+        std::memcpy(&w, s, n);
+        h = (h ^ w) * k;}
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;}
+
+// -------------
+// Intern_Header
+// -------------
+
+/*
+in front of the characters of every interned string, which follow it and end with a '\0'
+*/
+
+struct Intern_Header {
+    std::uint64_t hash;
+    std::size_t   size;
+
+    const char* data () const {
+        return reinterpret_cast<const char*>(this + 1);}};
+
+// ------
+// Symbol
+// ------
+
+class Symbol {
+    template <std::size_t>
+    friend class Intern_Pool;
+
+    private:
+        const char* _p;
+
+        static const char* empty () {
+            static const struct {
+                Intern_Header h;
+                char          c;} e = {{intern_hash("", 0), 0}, '\0'};
+            return e.h.data();}
+
+        const Intern_Header& header () const {
+            return *(reinterpret_cast<const Intern_Header*>(_p) - 1);}
+
+        explicit Symbol (const char* p) :
+                _p (p)
+            {}
+
+    public:
+        /**
+         * the empty string, the same Symbol in every pool
+         */
+        Symbol () :
+                _p (empty())
+            {}
+
+        const char* c_str () const {
+            return _p;}
+
+        std::size_t size () const {
+            return header().size;}
+
+        std::uint64_t hash () const {
+            return header().hash;}
+
+        std::string str () const {
+            return std::string(_p, size());}
+
+        friend bool operator == (const Symbol& lhs, const Symbol& rhs) {
+            return lhs._p == rhs._p;}
+
+        friend bool operator != (const Symbol& lhs, const Symbol& rhs) {
+            return !(lhs == rhs);}};
+
+namespace std {
+    template <>
+    struct hash<Symbol> {
+        size_t operator () (const Symbol& s) const {
+            return static_cast<size_t>(s.hash());}};}
+
+// ------------
+// Intern_Arena
+// ------------
+
+/*
+bump allocation from blocks of B bytes, nothing is freed before the arena
+a string too big for a block gets a block of its own
+*/
+
+class Intern_Arena {
+    private:
+        static const std::size_t B = 1 << 16;
+
+        std::vector<std::unique_ptr<Intern_Header[]>> _b;
+        char*                                         _p;
+        std::size_t                                   _r;
+
+    public:
+        Intern_Arena () :
+                _b (),
+                _p (nullptr),
+                _r (0)
+            {}
+
+        Intern_Arena             (const Intern_Arena&) = delete;
+        Intern_Arena& operator = (const Intern_Arena&) = delete;
+
+        /**
+         * n bytes aligned for an Intern_Header
+         */
+        void* allocate (std::size_t n) {
+            const std::size_t a = sizeof(Intern_Header);
+            n = (n + a - 1) / a * a;
+            if (n > _r) {
+                const std::size_t k = std::max(n, static_cast<std::size_t>(B));
+                _b.emplace_back(new Intern_Header[k / a]);
+                _p = reinterpret_cast<char*>(_b.back().get());
+                _r = k;}
+            void* const q = _p;
+            _p += n;
+            _r -= n;
+            return q;}};
+
+// -----------
+// Intern_Pool
+// -----------
+
+template <std::size_t N = 64>
+class Intern_Pool {
+    static_assert((N != 0) && ((N & (N - 1)) == 0), "N must be a power of two");
+
+    private:
+        // the hash is next to the pointer, so a probe only follows the pointer when the hashes match
+        // it is written before the pointer is published, and never again
+        struct Slot {
+            std::atomic<const Intern_Header*> p;
+            std::uint64_t                     h;};
+
+        struct Table {
+            std::size_t             mask;
+            std::unique_ptr<Slot[]> slots;
+
+            explicit Table (std::size_t k) :
+                    mask  (k - 1),
+                    slots (new Slot[k]()) // zero initialized
+                {}};
+
+        struct alignas(64) Shard {
+            std::mutex                          m;
+            std::atomic<Table*>                 t;
+            std::vector<std::unique_ptr<Table>> tables; // the current table last
+            Intern_Arena                        a;
+            std::size_t                         n;
+
+            Shard () :
+                    m      (),
+                    t      (nullptr),
+                    tables (),
+                    a      (),
+                    n      (0) {
+                tables.emplace_back(new Table(16));
+                t.store(tables.back().get(), std::memory_order_relaxed);}};
+
+        Shard _s[N];
+
+        static const Intern_Header* find (const Table& t, std::uint64_t h, const char* s, std::size_t n) {
+            for (std::size_t i = h & t.mask; ; i = (i + 1) & t.mask) {
+                const Intern_Header* const p = t.slots[i].p.load(std::memory_order_acquire);
+                if (!p)
+                    return nullptr;
+                if ((t.slots[i].h == h) && (p->size == n) && (std::memcmp(p->data(), s, n) == 0))
+                    return p;}}
+
+        static void place (Table& t, const Intern_Header* p) {
+            std::size_t i = p->hash & t.mask;
+            while (t.slots[i].p.load(std::memory_order_relaxed))
+                i = (i + 1) & t.mask;
+            t.slots[i].h = p->hash;
+            t.slots[i].p.store(p, std::memory_order_release);}
+
+        // the shard's lock is held, the table is kept at most half full
+        static const Intern_Header* insert (Shard& x, std::uint64_t h, const char* s, std::size_t n) {
+            Table* t = x.t.load(std::memory_order_relaxed);
+            if (2 * (x.n + 1) > t->mask + 1) {
+                Table* const u = new Table(2 * (t->mask + 1));
+                x.tables.emplace_back(u);
+                for (std::size_t i = 0; i <= t->mask; ++i)
+                    if (const Intern_Header* const p = t->slots[i].p.load(std::memory_order_relaxed))
+                        place(*u, p);
+                x.t.store(u, std::memory_order_release);
+                t = u;}
+            Intern_Header* const p = static_cast<Intern_Header*>(x.a.allocate(sizeof(Intern_Header) + n + 1));
+            p->hash = h;
+            p->size = n;
+            char* const d = reinterpret_cast<char*>(p + 1);
+            std::memcpy(d, s, n);
+            d[n] = '\0';
+            place(*t, p);
+            ++x.n;
+            return p;}
+
+    public:
+        Intern_Pool () :
+                _s ()
+            {}
+
+        Intern_Pool             (const Intern_Pool&) = delete;
+        Intern_Pool& operator = (const Intern_Pool&) = delete;
+
+        /**
+         * the Symbol for the n characters at s, which may include '\0'
+         */
+        Symbol intern (const char* s, std::size_t n) {
+            if (n == 0)
+                return Symbol();
+            const std::uint64_t  h = intern_hash(s, n);
+            Shard&               x = _s[(h >> 32) & (N - 1)];
+            const Intern_Header* p = find(*x.t.load(std::memory_order_acquire), h, s, n);
+            if (p)
+                return Symbol(p->data());
+            std::lock_guard<std::mutex> g(x.m);
+            p = find(*x.t.load(std::memory_order_relaxed), h, s, n);
+            if (!p)
+                p = insert(x, h, s, n);
+            return Symbol(p->data());}
+
+        Symbol intern (const char* s) {
+            return intern(s, std::strlen(s));}
+
+        Symbol intern (const std::string& s) {
+            return intern(s.data(), s.size());}
+
+        /**
+         * the number of distinct non-empty strings, exact once the writers are done
+         */
+        std::size_t size () {
+            std::size_t k = 0;
+            for (std::size_t i = 0; i != N; ++i) {
+                std::lock_guard<std::mutex> g(_s[i].m);
+                k += _s[i].n;}
+            return k;}};
+
+// ------
+// intern
+// ------
+
+/**
+ * intern into the pool of the process
+ */
+inline Symbol intern (const std::string& s) {
+    static Intern_Pool<> x;
+    return x.intern(s);}
+
+#endif // Intern_h
@@ -0,0 +1,124 @@
+// ---------------
+// InternBench.c++
+// ---------------
+
+#include <cstdio>        // printf
+#include <cstdlib>       // atoi
+#include <cstring>       // strcmp
+#include <functional>    // hash
+#include <mutex>         // lock_guard, mutex
+#include <string>        // string, to_string
+#include <thread>        // thread
+#include <unordered_set> // unordered_set
+#include <vector>        // vector
+
+#include "Bench.h"
+#include "Intern.h"
+
+// the baseline that the pool replaces, one lock around one set
+class Locked_Set {
+    private:
+        std::mutex                      _m;
+        std::unordered_set<std::string> _s;
+
+    public:
+        Locked_Set () :
+                _m (),
+                _s ()
+            {}
+
+        const std::string* intern (const std::string& s) {
+            std::lock_guard<std::mutex> g(_m);
+            return &*_s.insert(s).first;}};
+
+template <typename F>
+double threaded (int t, F f) {
+    return bench([&] () {
+        std::vector<std::thread> x;
+        for (int i = 0; i != t; ++i)
+            x.emplace_back(f, i);
+        for (std::thread& th : x)
+            th.join();}, 3);}
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const int k = (argc > 1) ? atoi(argv[1]) : (1 << 16); // distinct identifiers
+    const int m = 1 << 20;                                 // operations per thread
+
+    vector<string> w;
+    for (int i = 0; i != k; ++i)
+        w.push_back("identifier_" + to_string(i * 2654435761u % 1000003));
+    vector<int> q(m);
+    for (int i = 0; i != m; ++i)
+        q[i] = static_cast<int>((i * 40503u) % k);
+
+    printf("single thread, %d distinct identifiers, Mops/s\n", k);
+    printf("%-24s %12s %12s\n", "", "insert", "lookup");
+    {
+    unordered_set<string> s;
+    const double t1 = bench([&] () {unordered_set<string> x; for (const string& v : w) do_not_optimize(&*x.insert(v).first);}, 3);
+    for (const string& v : w)
+        s.insert(v);
+    const double t2 = bench([&] () {for (int i : q) do_not_optimize(&*s.find(w[i]));}, 3);
+    printf("%-24s %12.1f %12.1f\n", "unordered_set<string>", k / t1 / 1e6, m / t2 / 1e6);
+    }
+    {
+    Intern_Pool<> p;
+    const double t1 = bench([&] () {Intern_Pool<> x; for (const string& v : w) do_not_optimize(x.intern(v).c_str());}, 3);
+    for (const string& v : w)
+        p.intern(v);
+    const double t2 = bench([&] () {for (int i : q) do_not_optimize(p.intern(w[i]).c_str());}, 3);
+    printf("%-24s %12.1f %12.1f\n", "Intern_Pool", k / t1 / 1e6, m / t2 / 1e6);
+    }
+
+    printf("\nthreads, lookups of interned identifiers, total Mops/s\n");
+    printf("%8s %14s %14s\n", "threads", "Locked_Set", "Intern_Pool");
+    for (int t = 1; t <= 8; t <<= 1) {
+        Locked_Set    s;
+        Intern_Pool<> p;
+        for (const string& v : w) {
+            s.intern(v);
+            p.intern(v);}
+        const double t1 = threaded(t, [&] (int j) {for (int i = 0; i != m; ++i) do_not_optimize(s.intern(w[q[(i + j * 977) % m]]));});
+        const double t2 = threaded(t, [&] (int j) {for (int i = 0; i != m; ++i) do_not_optimize(p.intern(w[q[(i + j * 977) % m]]).c_str());});
+        printf("%8d %14.1f %14.1f\n", t, double(t) * m / t1 / 1e6, double(t) * m / t2 / 1e6);}
+
+    printf("\nthreads, every thread interning every identifier into a fresh pool, total Mops/s\n");
+    printf("%8s %14s %14s\n", "threads", "Locked_Set", "Intern_Pool");
+    for (int t = 1; t <= 8; t <<= 1) {
+        const double t1 = bench([&] () {
+            Locked_Set s;
+            vector<thread> x;
+            for (int j = 0; j != t; ++j)
+                x.emplace_back([&, j] () {for (int i = 0; i != k; ++i) do_not_optimize(s.intern(w[(i + j * 977) % k]));});
+            for (thread& th : x)
+                th.join();}, 3);
+        const double t2 = bench([&] () {
+            Intern_Pool<> p;
+            vector<thread> x;
+            for (int j = 0; j != t; ++j)
+                x.emplace_back([&, j] () {for (int i = 0; i != k; ++i) do_not_optimize(p.intern(w[(i + j * 977) % k]).c_str());});
+            for (thread& th : x)
+                th.join();}, 3);
+        printf("%8d %14.1f %14.1f\n", t, double(t) * k / t1 / 1e6, double(t) * k / t2 / 1e6);}
+
+    printf("\ncompare and hash interned identifiers, ns per operation\n");
+    {
+    Intern_Pool<> p;
+    vector<Symbol> y;
+    for (const string& v : w)
+        y.push_back(p.intern(v));
+    int c = 0;
+    const double t1 = bench([&] () {for (int i = 1; i != m; ++i) c += (strcmp(w[q[i]].c_str(), w[q[i - 1]].c_str()) == 0);});
+    const double t2 = bench([&] () {for (int i = 1; i != m; ++i) c += (y[q[i]] == y[q[i - 1]]);});
+    size_t h = 0;
+    const double t3 = bench([&] () {for (int i = 0; i != m; ++i) h += hash<string>()(w[q[i]]);});
+    const double t4 = bench([&] () {for (int i = 0; i != m; ++i) h += hash<Symbol>()(y[q[i]]);});
+    do_not_optimize(c);
+    do_not_optimize(h);
+    printf("%-24s %10.3fns\n", "strcmp",              t1 * 1e9 / m);
+    printf("%-24s %10.3fns\n", "Symbol ==",           t2 * 1e9 / m);
+    printf("%-24s %10.3fns\n", "hash<string>",        t3 * 1e9 / m);
+    printf("%-24s %10.3fns\n", "hash<Symbol>",        t4 * 1e9 / m);
+    }
+    return 0;}
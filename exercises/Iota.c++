@@ -0,0 +1,76 @@
+// --------
+// Iota.c++
+// --------
+
+// http://en.cppreference.com/w/cpp/algorithm/iota
+
+#include <algorithm> // equal
+#include <climits>   // INT_MAX
+#include <deque>     // deque
+#include <list>      // list
+#include <string>    // string
+#include <vector>    // vector
+
+#include "gtest/gtest.h"
+
+#include "Iota.h"
+#include "Range.h"
+#include "RangeIterator.h"
+
+using namespace std;
+
+TEST(IotaFixture, test_1) {
+    ASSERT_TRUE (is_contiguous_iterator<int*>::value);
+    ASSERT_TRUE (is_contiguous_iterator<const int*>::value);
+    ASSERT_FALSE(is_contiguous_iterator<list<int>::iterator>::value);
+    ASSERT_FALSE(is_contiguous_iterator<deque<int>::iterator>::value);
+    ASSERT_FALSE(is_contiguous_iterator<vector<bool>::iterator>::value);}
+
+#ifdef __GLIBCXX__
+TEST(IotaFixture, test_2) {
+    ASSERT_TRUE(is_contiguous_iterator<vector<int>::iterator>::value);
+    ASSERT_TRUE(is_contiguous_iterator<vector<int>::const_iterator>::value);
+    ASSERT_TRUE(is_contiguous_iterator<string::iterator>::value);
+    vector<int> x(3);
+    ASSERT_EQ(x.data(),     contiguous_iterator_traits<vector<int>::iterator>::pointer(begin(x)));
+    ASSERT_EQ(x.data() + 3, contiguous_iterator_traits<vector<int>::iterator>::pointer(end(x)));}
+#endif
+
+TEST(IotaFixture, test_3) {
+    ASSERT_TRUE (is_counting_iterator<Range<int>::iterator>::value);
+    ASSERT_TRUE (is_counting_iterator<Range_Iterator<long>>::value);
+    ASSERT_FALSE(is_counting_iterator<Range<double>::iterator>::value);
+    ASSERT_FALSE(is_counting_iterator<int*>::value);
+    ASSERT_FALSE(is_counting_iterator<vector<int>::iterator>::value);}
+
+TEST(IotaFixture, test_4) {
+    vector<int> x(5);
+    my_iota(begin(x), end(x), 2);
+    ASSERT_TRUE(equal(begin(x), end(x), begin({2, 3, 4, 5, 6})));
+    my_iota(begin(x), end(x), 10, -3);
+    ASSERT_TRUE(equal(begin(x), end(x), begin({10, 7, 4, 1, -2})));}
+
+TEST(IotaFixture, test_5) {
+    list<int> x(5);
+    my_iota(begin(x), end(x), 1, 2);
+    ASSERT_TRUE(equal(begin(x), end(x), begin({1, 3, 5, 7, 9})));
+    vector<double> y(3);
+    my_iota(begin(y), end(y), 0.5, 0.25);
+    ASSERT_TRUE(equal(begin(y), end(y), begin({0.5, 0.75, 1.0})));}
+
+TEST(IotaFixture, test_6) {
+    for (int n = 0; n != 100; ++n) {
+        vector<short> x(n);
+        list<short>   y(n);
+        my_iota(begin(x), end(x), short(-7), short(3));
+        my_iota(begin(y), end(y), short(-7), short(3));
+        ASSERT_TRUE(equal(begin(x), end(x), begin(y))) << n;}}
+
+TEST(IotaFixture, test_7) {
+    vector<int> x(3);
+    my_iota(begin(x), end(x), INT_MAX - 2);
+    ASSERT_EQ(INT_MAX, x[2]);
+    unsigned char y[300];
+    my_iota(y, y + 300, 0);
+    ASSERT_EQ(255, y[255]);
+    ASSERT_EQ(0,   y[256]);}
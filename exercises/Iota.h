@@ -0,0 +1,90 @@
+// ------
+// Iota.h
+// ------
+
+#ifndef Iota_h
+#define Iota_h
+
+#include <cstddef>     // size_t
+#include <iterator>    // iterator_traits
+#include <type_traits> // enable_if, false_type, integral_constant, is_integral, make_unsigned, true_type
+
+#include "ContiguousIterator.h"
+
+// --------------------
+// is_counting_iterator
+// --------------------
+
+/*
+a counting iterator yields an integral arithmetic progression, *(i + n) == *i + n
+it says so with a nested is_counting, like Range<T>::iterator and Range_Iterator<T>
+*/
+
+template <typename I, typename = void>
+struct is_counting_iterator :
+        std::false_type
+    {};
+
+template <typename I>
+struct is_counting_iterator<I, typename std::enable_if<I::is_counting::value>::type> :
+        std::true_type
+    {};
+
+// ------------------
+// my_iota_contiguous
+// ------------------
+
+/*
+v, v + s, v + 2s, ... into [b, e), T integral
+each element is computed from its index, not from the one before it,
+so there is no dependency between iterations and the loop vectorizes
+into a vector of lanes that steps by the vector width times s
+the arithmetic is unsigned, running past the end of a signed T is not an overflow
+*/
+
+template <typename T>
+T* my_iota_contiguous (T* b, T* e, T v, T s) {
+    static_assert(std::is_integral<T>::value, "T must be an integral type");
+    typedef typename std::make_unsigned<T>::type U;
+    const std::size_t n = e - b;
+    const U           d = static_cast<U>(s);
+    U                 a = static_cast<U>(v);
+    for (std::size_t i = 0; i != n; ++i) {
+        b[i] = static_cast<T>(a);
+        a += d;}
+    return e;}
+
+// -------
+// my_iota
+// -------
+
+template <typename FI, typename T>
+void my_iota_loop (FI b, FI e, T v, T s) {
+    while (b != e) {
+        *b = v;
+        v += s;
+        ++b;}}
+
+template <typename FI, typename T>
+void my_iota_dispatch (FI b, FI e, T v, T s, std::false_type) {
+    my_iota_loop(b, e, v, s);}
+
+template <typename FI, typename T>
+void my_iota_dispatch (FI b, FI e, T v, T s, std::true_type) {
+    typedef contiguous_iterator_traits<FI>                traits;
+    typedef typename std::iterator_traits<FI>::value_type value_type;
+    my_iota_contiguous(traits::pointer(b), traits::pointer(b) + (e - b), static_cast<value_type>(v), static_cast<value_type>(s));}
+
+/**
+ * v, v + s, v + 2s, ... into [b, e)
+ * std::iota with a step
+ */
+template <typename FI, typename T>
+void my_iota (FI b, FI e, T v, T s = T(1)) {
+    my_iota_dispatch(b, e, v, s,
+        std::integral_constant<bool,
+            is_contiguous_iterator<FI>::value &&
+            std::is_integral<typename std::iterator_traits<FI>::value_type>::value &&
+            std::is_integral<T>::value>());}
+
+#endif // Iota_h
@@ -0,0 +1,95 @@
+// ------------
+// IsPrime3.c++
+// ------------
+
+// https://en.wikipedia.org/wiki/Miller%E2%80%93Rabin_primality_test
+
+#include <cmath>   // sqrt
+#include <cstdint> // uint64_t
+
+#include "gtest/gtest.h"
+
+#include "IsPrime3.h"
+
+TEST(IsPrimeFixture, test_1) {
+    ASSERT_FALSE(is_prime( 1));}
+
+TEST(IsPrimeFixture, test_2) {
+    ASSERT_TRUE(is_prime( 2));}
+
+TEST(IsPrimeFixture, test_3) {
+    ASSERT_TRUE(is_prime( 3));}
+
+TEST(IsPrimeFixture, test_4) {
+    ASSERT_FALSE(is_prime( 4));}
+
+TEST(IsPrimeFixture, test_5) {
+    ASSERT_TRUE(is_prime( 5));}
+
+TEST(IsPrimeFixture, test_7) {
+    ASSERT_TRUE(is_prime( 7));}
+
+TEST(IsPrimeFixture, test_9) {
+    ASSERT_FALSE(is_prime( 9));}
+
+TEST(IsPrimeFixture, test_27) {
+    ASSERT_FALSE(is_prime(27));}
+
+TEST(IsPrimeFixture, test_29) {
+    ASSERT_TRUE(is_prime(29));}
+
+TEST(IsPrimeFixture, test_0) {
+    ASSERT_FALSE(is_prime(0));}
+
+TEST(IsPrimeFixture, test_561) {
+    ASSERT_FALSE(is_prime(561));}                                   // Carmichael
+
+TEST(IsPrimeFixture, test_1373653) {
+    ASSERT_FALSE(is_prime(1373653ULL));}                            // strong pseudoprime to 2, 3
+
+TEST(IsPrimeFixture, test_4759123141) {
+    ASSERT_FALSE(is_prime(4759123141ULL));}                         // strong pseudoprime to 2, 7, 61
+
+TEST(IsPrimeFixture, test_3215031751) {
+    ASSERT_FALSE(is_prime(3215031751ULL));}                         // strong pseudoprime to 2, 3, 5, 7
+
+TEST(IsPrimeFixture, test_3825123056546413051) {
+    ASSERT_FALSE(is_prime(3825123056546413051ULL));}                // strong pseudoprime to 2 through 23
+
+TEST(IsPrimeFixture, test_1000000007) {
+    ASSERT_TRUE(is_prime(1000000007ULL));}
+
+TEST(IsPrimeFixture, test_2305843009213693951) {
+    ASSERT_TRUE(is_prime(2305843009213693951ULL));}                 // 2^61 - 1
+
+TEST(IsPrimeFixture, test_18446744073709551557) {
+    ASSERT_TRUE(is_prime(18446744073709551557ULL));}                // 2^64 - 59
+
+TEST(IsPrimeFixture, test_18446744073709551615) {
+    ASSERT_FALSE(is_prime(18446744073709551615ULL));}               // 2^64 - 1
+
+TEST(IsPrimeFixture, test_4294967291) {
+    ASSERT_FALSE(is_prime(4294967291ULL * 4294967279ULL));}         // product of the two largest 32 bit primes
+
+TEST(IsPrimeFixture, test_range) {
+    for (std::uint64_t n = 1; n != 100000; ++n) {
+        bool b = (n > 1);
+        for (std::uint64_t i = 2; (i * i) <= n; ++i)
+            if ((n % i) == 0) {
+                b = false;
+                break;}
+        ASSERT_EQ(b, is_prime(n)) << n;}}
+
+TEST(IsPrimeFixture, test_constexpr) {
+    static_assert( is_prime(    2), "");
+    static_assert( is_prime(   97), "");
+    static_assert(!is_prime(   91), "");
+    static_assert( is_prime(65521), "");
+    static_assert(!is_prime(65535), "");
+    constexpr bool b = is_prime(4093);
+    ASSERT_TRUE(b);}
+
+TEST(IsPrimeFixture, test_table) {
+    const std::uint64_t m = Prime_Table<PRIME_TABLE_BITS>::bound;
+    for (std::uint64_t n = 0; n != 2 * m; ++n)
+        ASSERT_EQ(is_prime_miller_rabin(n), is_prime(n)) << n;}
@@ -0,0 +1,122 @@
+// ----------
+// IsPrime3.h
+// ----------
+
+#ifndef IsPrime3_h
+#define IsPrime3_h
+
+#include <cstdint> // uint64_t
+
+#include "PrimeTable.h"
+
+/*
+64 bit primality
+below 2^PRIME_TABLE_BITS, a lookup in a table built at compile time
+above, a wheel and small prime trial division reject most composites,
+deterministic Miller-Rabin settles the rest, with 2, 3 or 7 bases
+depending on the size of n
+*/
+
+__extension__ typedef unsigned __int128 uint128_t;
+
+// ------
+// mulmod
+// ------
+
+inline std::uint64_t mulmod (std::uint64_t a, std::uint64_t b, std::uint64_t m) {
+    return static_cast<std::uint64_t>(static_cast<uint128_t>(a) * b % m);}
+
+// ------
+// powmod
+// ------
+
+inline std::uint64_t powmod (std::uint64_t a, std::uint64_t d, std::uint64_t m) {
+    std::uint64_t r = 1;
+    a %= m;
+    while (d != 0) {
+        if (d & 1)
+            r = mulmod(r, a, m);
+        a = mulmod(a, a, m);
+        d >>= 1;}
+    return r;}
+
+// ------------
+// miller_rabin
+// ------------
+
+/*
+n odd, n > 2, n - 1 == d * 2^s, d odd
+true if n is a strong probable prime to base a
+*/
+
+inline bool miller_rabin (std::uint64_t n, std::uint64_t d, int s, std::uint64_t a) {
+    a %= n;
+    if (a == 0)
+        return true;
+    std::uint64_t x = powmod(a, d, n);
+    if ((x == 1) || (x == n - 1))
+        return true;
+    for (int i = 1; i != s; ++i) {
+        x = mulmod(x, x, n);
+        if (x == n - 1)
+            return true;}
+    return false;}
+
+// ---------------------
+// is_prime_miller_rabin
+// ---------------------
+
+inline bool is_prime_miller_rabin (std::uint64_t n) {
+    // residues mod 210 = 2 * 3 * 5 * 7 that are coprime to 210, one bit each
+    static const std::uint64_t wheel[] = {
+        0x28208a20a08a2802ULL, 0x820228a202088288ULL, 0x8828228820a08a08ULL, 0x00000000000200a2ULL};
+    static const unsigned small[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+    static const std::uint64_t bases_2[] = {2, 3};                                             // n < 1373653
+    static const std::uint64_t bases_3[] = {2, 7, 61};                                         // n < 4759123141
+    static const std::uint64_t bases_7[] = {2, 325, 9375, 28178, 450775, 9780504, 1795265022}; // n < 2^64
+
+    if (n < 2)
+        return false;
+    for (int i = 0; i != 4; ++i)
+        if (n == small[i])
+            return true;
+    const unsigned r = n % 210;
+    if (!((wheel[r / 64] >> (r % 64)) & 1))
+        return false;
+    for (int i = 4; i != 16; ++i)
+        if ((n % small[i]) == 0)
+            return n == small[i];
+    if (n < 59 * 59)
+        return true;
+
+    std::uint64_t d = n - 1;
+    int           s = 0;
+    while ((d & 1) == 0) {
+        d >>= 1;
+        ++s;}
+    const std::uint64_t* b = bases_7;
+    const std::uint64_t* e = bases_7 + 7;
+    if (n < 1373653ULL) {
+        b = bases_2;
+        e = bases_2 + 2;}
+    else if (n < 4759123141ULL) {
+        b = bases_3;
+        e = bases_3 + 3;}
+    for (; b != e; ++b)
+        if (!miller_rabin(n, d, s, *b))
+            return false;
+    return true;}
+
+// --------
+// is_prime
+// --------
+
+/**
+ * a constant expression for n below the table bound
+ */
+constexpr bool is_prime (std::uint64_t n) {
+    return (n < Prime_Table<PRIME_TABLE_BITS>::bound) ?
+        Prime_Table<PRIME_TABLE_BITS>::test(n) :
+        is_prime_miller_rabin(n);}
+
+#endif // IsPrime3_h
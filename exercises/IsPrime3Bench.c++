@@ -0,0 +1,52 @@
+// -----------------
+// IsPrime3Bench.c++
+// -----------------
+
+#include <cstdint> // uint64_t
+#include <cstdio>  // printf
+#include <random>  // mt19937_64
+#include <vector>  // vector
+
+#include "Bench.h"
+#include "IsPrime3.h"
+
+// IsPrime2, widened to 64 bits
+bool is_prime_trial (std::uint64_t n) {
+    if (n == 2)
+        return true;
+    if ((n < 2) || ((n % 2) == 0))
+        return false;
+    for (std::uint64_t i = 3; (i * i) <= n; i += 2)
+        if ((n % i) == 0)
+            return false;
+    return true;}
+
+int main () {
+    using namespace std;
+    mt19937_64 g(1);
+    printf("%5s %12s %12s %8s\n", "bits", "trial", "is_prime", "primes");
+    for (int k = 16; k <= 64; k += 8) {
+        const int n = (k <= 32) ? 100000 : (k <= 40) ? 2000 : 100000;
+        vector<uint64_t> x(n);
+        for (int i = 0; i != n; ++i)
+            x[i] = (g() >> (64 - k)) | (uint64_t(1) << (k - 1)) | 1;
+        int c = 0;
+        const double t2 = bench([&] () {c = 0; for (int i = 0; i != n; ++i) c += is_prime(x[i]); do_not_optimize(c);}, 3);
+        if (k <= 40) {
+            const double t1 = bench([&] () {int d = 0; for (int i = 0; i != n; ++i) d += is_prime_trial(x[i]); do_not_optimize(d);}, 1);
+            printf("%5d %10.1fns %10.1fns %8d\n", k, t1 * 1e9 / n, t2 * 1e9 / n, c);}
+        else
+            printf("%5d %12s %10.1fns %8d\n", k, "-", t2 * 1e9 / n, c);}
+
+    // a mix of table sized and 64 bit n
+    const int      n = 1000000;
+    const uint64_t m = Prime_Table<PRIME_TABLE_BITS>::bound;
+    printf("\n%8s %14s %14s\n", "small", "miller-rabin", "table");
+    for (int p = 100; p >= 0; p -= 25) {
+        vector<uint64_t> x(n);
+        for (int i = 0; i != n; ++i)
+            x[i] = (static_cast<int>(g() % 100) < p) ? g() % m : g() | 1;
+        const double t1 = bench([&] () {int c = 0; for (int i = 0; i != n; ++i) c += is_prime_miller_rabin(x[i]); do_not_optimize(c);}, 3);
+        const double t2 = bench([&] () {int c = 0; for (int i = 0; i != n; ++i) c += is_prime(x[i]);              do_not_optimize(c);}, 3);
+        printf("%7d%% %12.1fns %12.1fns\n", p, t1 * 1e9 / n, t2 * 1e9 / n);}
+    return 0;}
@@ -0,0 +1,112 @@
+// -----------------
+// MappedArchive.c++
+// -----------------
+
+#include <cstdint>      // uintptr_t
+#include <cstdio>       // remove
+#include <fstream>      // fstream, ofstream
+#include <stdexcept>    // invalid_argument, out_of_range
+#include <string>       // string
+#include <system_error> // system_error
+#include <vector>       // vector
+
+#include <unistd.h>     // truncate
+
+#include "gtest/gtest.h"
+
+#include "MappedArchive.h"
+
+using namespace std;
+
+struct Point {
+    int    x;
+    double y;};
+
+struct MappedArchiveFixture : ::testing::Test {
+    const string f = "MappedArchive.bin";
+
+    void TearDown () override {
+        remove(f.c_str());}};
+
+TEST_F(MappedArchiveFixture, test_1) {
+    const vector<double> x = {1.5, 2.5, 3.5};
+    const vector<int>    y = {2, 3, 4, 5, 6};
+    const long           z = 42;
+    {
+    Mapped_Archive_Writer w;
+    ASSERT_EQ(0u, w.add(x));
+    ASSERT_EQ(1u, w.add(y));
+    ASSERT_EQ(2u, w.add(z));
+    w.save(f);
+    }
+    const Mapped_Archive a(f);
+    ASSERT_EQ(3u, a.size());
+    const Mapped_Array<double> b = a.array<double>(0);
+    const Mapped_Array<int>    c = a.array<int>(1);
+    ASSERT_EQ(x, vector<double>(b.begin(), b.end()));
+    ASSERT_EQ(y, vector<int>(c.begin(), c.end()));
+    ASSERT_EQ(42, a.value<long>(2));}
+
+TEST_F(MappedArchiveFixture, test_2) {
+    const vector<char>  x = {'a', 'b', 'c'};
+    const vector<Point> y = {{1, 1.5}, {2, 2.5}};
+    const vector<int>   z;
+    {
+    Mapped_Archive_Writer w;
+    w.add(x);
+    w.add(y);
+    w.add(z);
+    w.save(f);
+    }
+    const Mapped_Archive a(f);
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(a.array<char>(0).data())  % Mapped_Archive_Header::A);
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(a.array<Point>(1).data()) % Mapped_Archive_Header::A);
+    ASSERT_EQ(2,   a.array<Point>(1)[1].x);
+    ASSERT_EQ(2.5, a.array<Point>(1)[1].y);
+    ASSERT_EQ(0u,  a.array<int>(2).size());}
+
+TEST_F(MappedArchiveFixture, test_3) {
+    vector<vector<int>> x(3000);
+    Mapped_Archive_Writer w;
+    for (int i = 0; i != 3000; ++i) {
+        x[i].assign(i % 17, i);
+        w.add(x[i]);}
+    w.save(f);
+    const Mapped_Archive a(f);
+    ASSERT_EQ(3000u, a.size());
+    for (int i = 0; i != 3000; ++i) {
+        const Mapped_Array<int> b = a.array<int>(i);
+        ASSERT_EQ(x[i], vector<int>(b.begin(), b.end()));}}
+
+TEST_F(MappedArchiveFixture, test_4) {
+    const vector<int> x = {2, 3, 4};
+    Mapped_Archive_Writer w;
+    w.add(x);
+    w.save(f);
+    const Mapped_Archive a(f);
+    ASSERT_THROW(a.array<double>(0), invalid_argument);
+    ASSERT_THROW(a.array<int>(1),    out_of_range);
+    ASSERT_THROW(a.value<int>(0),    invalid_argument);}
+
+TEST_F(MappedArchiveFixture, test_5) {
+    ASSERT_THROW(Mapped_Archive("MappedArchive.none"), system_error);
+    {
+    ofstream out(f);
+    out << "not an archive, but long enough to hold a header, if it were one, which it is not";
+    }
+    ASSERT_THROW(Mapped_Archive a(f), invalid_argument);}
+
+TEST_F(MappedArchiveFixture, test_6) {
+    const vector<double> x(1000, 1.0);
+    Mapped_Archive_Writer w;
+    w.add(x);
+    w.save(f);
+    {
+    fstream io(f, ios::in | ios::out | ios::binary);
+    io.seekp(sizeof(Mapped_Archive_Header) + 24); // the width of entry 0
+    const char c = 1;
+    io.write(&c, 1);
+    }
+    ASSERT_THROW(Mapped_Archive a(f), invalid_argument);
+    ASSERT_EQ(0, truncate(f.c_str(), 4000));
+    ASSERT_THROW(Mapped_Archive a(f), invalid_argument);}
@@ -0,0 +1,271 @@
+// ---------------
+// MappedArchive.h
+// ---------------
+
+#ifndef MappedArchive_h
+#define MappedArchive_h
+
+#include <algorithm>    // min
+#include <cerrno>       // EINTR, errno
+#include <climits>      // IOV_MAX
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t, uint64_t
+#include <cstring>      // memcmp, memcpy
+#include <stdexcept>    // invalid_argument, out_of_range
+#include <string>       // string, to_string
+#include <system_error> // generic_category, system_error
+#include <vector>       // vector
+
+#include <fcntl.h>      // open
+#include <sys/uio.h>    // iovec, writev
+#include <unistd.h>     // close
+
+#include "Dispatch.h"
+#include "MappedFile.h"
+
+/*
+an archive of arrays of trivially copyable values, like numbers or an Allocator's arena,
+that is written with one gathered write and read back by mapping the file,
+so that nothing is copied on either side and the arrays are used in place
+
+unlike binary_oarchive, nothing goes through a stream, the values are not visited one at a time,
+and loading costs a page fault per page touched instead of a copy of the whole file
+
+the layout, in the byte order of the machine that wrote it:
+    header  : 64 bytes, the magic, the version, a byte order mark, the entry count, the file size
+    entries : 32 bytes each, the offset, the size in bytes, the count, and the width of each array
+    arrays  : each one aligned to A bytes, so a mapped array is aligned for any T up to A
+*/
+
+// ---------------------
+// Mapped_Archive_Header
+// ---------------------
+
+struct Mapped_Archive_Header {
+    static const std::size_t A = 64;
+
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t order;
+    std::uint64_t count;
+    std::uint64_t size;
+    std::uint64_t reserved[4];};
+
+// --------------------
+// Mapped_Archive_Entry
+// --------------------
+
+struct Mapped_Archive_Entry {
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::uint64_t count;
+    std::uint32_t width;
+    std::uint32_t reserved;};
+
+static_assert(sizeof(Mapped_Archive_Header) == Mapped_Archive_Header::A, "the header must be one alignment unit");
+static_assert(sizeof(Mapped_Archive_Entry)  == 32,                       "the entries must be 32 bytes");
+
+// 8 bytes, with the '\0'
+inline const char* mapped_archive_magic () {
+    return "MAPARCH";}
+
+// ---------------------
+// Mapped_Archive_Writer
+// ---------------------
+
+/*
+add records where an array is, it does not copy it
+the arrays have to stay alive and unchanged until save
+*/
+
+class Mapped_Archive_Writer {
+    private:
+        std::vector<const void*>          _p;
+        std::vector<Mapped_Archive_Entry> _e;
+
+        static std::size_t align (std::size_t n) {
+            return (n + Mapped_Archive_Header::A - 1) / Mapped_Archive_Header::A * Mapped_Archive_Header::A;}
+
+        // writev as many times as it takes, a write may be short and it takes at most IOV_MAX buffers
+        static void write_all (int d, std::vector<iovec>& v, const std::string& f) {
+            std::size_t i = 0;
+            while (i != v.size()) {
+                const int     k = static_cast<int>(std::min<std::size_t>(v.size() - i, IOV_MAX));
+                const ssize_t r = ::writev(d, &v[i], k);
+                if (r == -1) {
+                    if (errno == EINTR)
+                        continue;
+                    throw std::system_error(errno, std::generic_category(), f);}
+                std::size_t n = r;
+                while ((i != v.size()) && (n >= v[i].iov_len)) {
+                    n -= v[i].iov_len;
+                    ++i;}
+                if (n != 0) {
+                    v[i].iov_base = static_cast<char*>(v[i].iov_base) + n;
+                    v[i].iov_len -= n;}}}
+
+    public:
+        Mapped_Archive_Writer () :
+                _p (),
+                _e ()
+            {}
+
+        /**
+         * n values at b, returns the index of the entry
+         */
+        template <typename T>
+        std::size_t add (const T* b, std::size_t n) {
+            static_assert(is_memmove_copyable<T>::value, "T must be trivially copyable");
+            static_assert(alignof(T) <= Mapped_Archive_Header::A, "T must not be over aligned");
+            Mapped_Archive_Entry e = {0, n * sizeof(T), n, sizeof(T), 0};
+            _p.push_back(b);
+            _e.push_back(e);
+            return _e.size() - 1;}
+
+        template <typename T>
+        std::size_t add (const std::vector<T>& x) {
+            return add(x.data(), x.size());}
+
+        template <typename T>
+        std::size_t add (const T& v) {
+            return add(&v, 1);}
+
+        /**
+         * lays the arrays out and writes the file with one gathered write
+         */
+        void save (const std::string& f) const {
+            const std::size_t            n = _e.size();
+            std::vector<char>            h(align(sizeof(Mapped_Archive_Header) + n * sizeof(Mapped_Archive_Entry)));
+            std::vector<iovec>           v;
+            static const char            z[Mapped_Archive_Header::A] = {};
+            Mapped_Archive_Header* const p = reinterpret_cast<Mapped_Archive_Header*>(h.data());
+            Mapped_Archive_Entry*  const q = reinterpret_cast<Mapped_Archive_Entry*>(p + 1);
+            std::uint64_t                s = h.size();
+            v.push_back(iovec {h.data(), h.size()});
+            for (std::size_t i = 0; i != n; ++i) {
+                q[i]        = _e[i];
+                q[i].offset = s;
+                if (_e[i].size != 0)
+                    v.push_back(iovec {const_cast<void*>(_p[i]), _e[i].size});
+                if (align(_e[i].size) != _e[i].size)
+                    v.push_back(iovec {const_cast<char*>(z), align(_e[i].size) - _e[i].size});
+                s += align(_e[i].size);}
+            std::memcpy(p->magic, mapped_archive_magic(), sizeof(p->magic));
+            p->version = 1;
+            p->order   = 0x01020304;
+            p->count   = n;
+            p->size    = s;
+
+            const int d = ::open(f.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (d == -1)
+                throw std::system_error(errno, std::generic_category(), f);
+            try {
+                write_all(d, v, f);}
+            catch (...) {
+                ::close(d);
+                throw;}
+            if (::close(d) == -1)
+                throw std::system_error(errno, std::generic_category(), f);}};
+
+// ------------
+// Mapped_Array
+// ------------
+
+/*
+an array inside a Mapped_Archive, valid as long as the archive
+*/
+
+template <typename T>
+class Mapped_Array {
+    private:
+        const T*    _b;
+        std::size_t _n;
+
+    public:
+        Mapped_Array (const T* b, std::size_t n) :
+                _b (b),
+                _n (n)
+            {}
+
+        Mapped_Array             (const Mapped_Array&) = default;
+        Mapped_Array& operator = (const Mapped_Array&) = default;
+
+        const T* begin () const {
+            return _b;}
+
+        const T* end () const {
+            return _b + _n;}
+
+        const T* data () const {
+            return _b;}
+
+        std::size_t size () const {
+            return _n;}
+
+        const T& operator [] (std::size_t i) const {
+            return _b[i];}};
+
+// --------------
+// Mapped_Archive
+// --------------
+
+class Mapped_Archive {
+    private:
+        Mapped_File                 _f;
+        const Mapped_Archive_Entry* _e;
+        std::size_t                 _n;
+
+        void check (bool b, const std::string& s) const {
+            if (!b)
+                throw std::invalid_argument("Mapped_Archive: " + s);}
+
+    public:
+        /**
+         * maps f and checks the header and every entry, does not read the arrays
+         */
+        explicit Mapped_Archive (const std::string& f) :
+                _f (f, MADV_NORMAL),
+                _e (nullptr),
+                _n (0) {
+            check(_f.size() >= sizeof(Mapped_Archive_Header), f + " is too short");
+            const Mapped_Archive_Header& h = *reinterpret_cast<const Mapped_Archive_Header*>(_f.data());
+            check(std::memcmp(h.magic, mapped_archive_magic(), sizeof(h.magic)) == 0, f + " is not an archive");
+            check(h.version == 1,          f + " has an unknown version");
+            check(h.order   == 0x01020304, f + " has the wrong byte order");
+            check(h.size    == _f.size(),  f + " is truncated");
+            check(h.count   <= (_f.size() - sizeof(h)) / sizeof(Mapped_Archive_Entry), f + " has too many entries");
+            _e = reinterpret_cast<const Mapped_Archive_Entry*>(&h + 1);
+            _n = h.count;
+            for (std::size_t i = 0; i != _n; ++i) {
+                const Mapped_Archive_Entry& e = _e[i];
+                check((e.offset % Mapped_Archive_Header::A) == 0,                         f + " has a misaligned entry");
+                check((e.width != 0) && (e.size / e.width == e.count) && (e.size % e.width == 0), f + " has an inconsistent entry");
+                check((e.offset <= _f.size()) && (e.size <= _f.size() - e.offset),           f + " has an entry past the end");}}
+
+        Mapped_Archive             (const Mapped_Archive&) = delete;
+        Mapped_Archive& operator = (const Mapped_Archive&) = delete;
+
+        /**
+         * the number of entries
+         */
+        std::size_t size () const {
+            return _n;}
+
+        /**
+         * entry i in place, T must be the type it was added as
+         */
+        template <typename T>
+        Mapped_Array<T> array (std::size_t i) const {
+            static_assert(is_memmove_copyable<T>::value, "T must be trivially copyable");
+            if (i >= _n)
+                throw std::out_of_range("Mapped_Archive: no entry " + std::to_string(i));
+            check(_e[i].width == sizeof(T), "entry " + std::to_string(i) + " is not an array of " + std::to_string(sizeof(T)) + " byte values");
+            return Mapped_Array<T>(reinterpret_cast<const T*>(_f.data() + _e[i].offset), _e[i].count);}
+
+        template <typename T>
+        const T& value (std::size_t i) const {
+            const Mapped_Array<T> a = array<T>(i);
+            check(a.size() == 1, "entry " + std::to_string(i) + " is not one value");
+            return a[0];}};
+
+#endif // MappedArchive_h
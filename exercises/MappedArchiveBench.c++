@@ -0,0 +1,96 @@
+// ----------------------
+// MappedArchiveBench.c++
+// ----------------------
+
+/*
+MappedArchiveBench.app [m]
+saves and loads an array of doubles of 1 MB, 100 MB, and 1 GB, up to m MB,
+with binary_oarchive and binary_iarchive, and with Mapped_Archive
+a load is timed until every value has been read once
+heap is the anonymous memory that a load adds, the data that it holds on to,
+a mapping adds none, its pages belong to the page cache
+the file was just written, so both loads read from the page cache, not the disk
+*/
+
+#include <cstdio>   // printf, remove
+#include <cstdlib>  // atoi
+#include <cstring>  // strncmp
+#include <fstream>  // ifstream, ofstream
+#include <numeric>  // accumulate
+#include <string>   // getline, string
+#include <vector>   // vector
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include "Bench.h"
+#include "MappedArchive.h"
+
+// the resident anonymous memory of the process in KB
+long rss_anon () {
+    std::ifstream in("/proc/self/status");
+    std::string   s;
+    while (std::getline(in, s))
+        if (std::strncmp(s.c_str(), "RssAnon:", 8) == 0)
+            return std::atol(s.c_str() + 8);
+    return 0;}
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    using namespace boost::archive;
+    const int         m = (argc > 1) ? atoi(argv[1]) : 1024;
+    const char* const f = "MappedArchiveBench.bin";
+
+    printf("%8s %-8s %12s %12s %12s\n", "MB", "archive", "save", "load", "heap");
+    for (int s : {1, 100, 1024}) {
+        if (s > m)
+            break;
+        const size_t         n = size_t(s) * (1 << 20) / sizeof(double);
+        const int            k = (s > 100) ? 1 : 3;
+        vector<double>       x(n);
+        for (size_t i = 0; i != n; ++i)
+            x[i] = i % 1000;
+        const double         v = accumulate(x.begin(), x.end(), 0.0);
+
+        {
+        const double t1 = bench([&] () {
+            ofstream        out(f, ios::binary);
+            binary_oarchive o(out);
+            o << x;}, k);
+        long   h = 0;
+        double t2 = 1e300;
+        for (int i = 0; i != k; ++i) {
+            const long                 r = rss_anon();
+            const chrono::steady_clock::time_point b = chrono::steady_clock::now();
+            ifstream        in(f, ios::binary);
+            binary_iarchive a(in);
+            vector<double>  y;
+            a >> y;
+            if (accumulate(y.begin(), y.end(), 0.0) != v)
+                return 1;
+            t2 = min(t2, chrono::duration<double>(chrono::steady_clock::now() - b).count());
+            h  = max(h, rss_anon() - r);}
+        printf("%8d %-8s %10.3fms %10.3fms %10.1fMB\n", s, "boost", t1 * 1e3, t2 * 1e3, h / 1024.0);
+        }
+
+        {
+        const double t1 = bench([&] () {
+            Mapped_Archive_Writer w;
+            w.add(x);
+            w.save(f);}, k);
+        long   h = 0;
+        double t2 = 1e300;
+        for (int i = 0; i != k; ++i) {
+            const long                 r = rss_anon();
+            const chrono::steady_clock::time_point b = chrono::steady_clock::now();
+            const Mapped_Archive       a(f);
+            const Mapped_Array<double> y = a.array<double>(0);
+            if (accumulate(y.begin(), y.end(), 0.0) != v)
+                return 1;
+            t2 = min(t2, chrono::duration<double>(chrono::steady_clock::now() - b).count());
+            h  = max(h, rss_anon() - r);}
+        printf("%8d %-8s %10.3fms %10.3fms %10.1fMB\n", s, "mapped", t1 * 1e3, t2 * 1e3, h / 1024.0);
+        }}
+    remove(f);
+    return 0;}
@@ -0,0 +1,70 @@
+// ------------
+// MappedFile.h
+// ------------
+
+#ifndef MappedFile_h
+#define MappedFile_h
+
+#include <cerrno>       // errno
+#include <cstddef>      // size_t
+#include <string>       // string
+#include <system_error> // generic_category, system_error
+
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // madvise, mmap, munmap
+#include <sys/stat.h>   // fstat
+#include <unistd.h>     // close
+
+// -----------
+// Mapped_File
+// -----------
+
+/*
+a read only mapping of a whole file
+the advice is for madvise, sequential for a scan, random for lookups
+*/
+
+class Mapped_File {
+    private:
+        int         _d;
+        const char* _p;
+        std::size_t _s;
+
+    public:
+        explicit Mapped_File (const std::string& f, int a = MADV_SEQUENTIAL) :
+                _d (::open(f.c_str(), O_RDONLY)),
+                _p (nullptr),
+                _s (0) {
+            if (_d == -1)
+                throw std::system_error(errno, std::generic_category(), f);
+            struct stat s;
+            if (::fstat(_d, &s) == -1) {
+                const int e = errno;
+                ::close(_d);
+                throw std::system_error(e, std::generic_category(), f);}
+            _s = s.st_size;
+            if (_s == 0)
+                return;
+            void* const p = ::mmap(nullptr, _s, PROT_READ, MAP_PRIVATE, _d, 0);
+            if (p == MAP_FAILED) {
+                const int e = errno;
+                ::close(_d);
+                throw std::system_error(e, std::generic_category(), f);}
+            ::madvise(p, _s, a);
+            _p = static_cast<const char*>(p);}
+
+        Mapped_File             (const Mapped_File&) = delete;
+        Mapped_File& operator = (const Mapped_File&) = delete;
+
+        ~Mapped_File () {
+            if (_p != nullptr)
+                ::munmap(const_cast<char*>(_p), _s);
+            ::close(_d);}
+
+        const char* data () const {
+            return _p;}
+
+        std::size_t size () const {
+            return _s;}};
+
+#endif // MappedFile_h
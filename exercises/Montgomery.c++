@@ -0,0 +1,48 @@
+// --------------
+// Montgomery.c++
+// --------------
+
+// https://en.wikipedia.org/wiki/Montgomery_modular_multiplication
+
+#include <cstdint> // uint64_t
+#include <random>  // mt19937_64
+
+#include "gtest/gtest.h"
+
+#include "IsPrime3.h"
+#include "Montgomery.h"
+
+using namespace std;
+
+TEST(MontgomeryFixture, test_1) {
+    const Montgomery m(97);
+    ASSERT_EQ(97u, m.modulus());
+    ASSERT_EQ( 1u, m.from(m.one()));
+    ASSERT_EQ(42u, m.from(m.to(42)));
+    ASSERT_EQ( 3u, m.from(m.to(100)));}
+
+TEST(MontgomeryFixture, test_2) {
+    const Montgomery m(97);
+    ASSERT_EQ((40u * 70u) % 97, m.from(m.mul(m.to(40), m.to(70))));
+    ASSERT_EQ((40u + 70u) % 97, m.from(m.add(m.to(40), m.to(70))));
+    ASSERT_EQ(97u - 30u,        m.from(m.sub(m.to(40), m.to(70))));
+    ASSERT_EQ( 1u,              m.from(m.pow(m.to(5), 96)));}
+
+TEST(MontgomeryFixture, test_3) {
+    mt19937_64 g(1);
+    for (int i = 0; i != 10000; ++i) {
+        const uint64_t n = g() | 1;
+        const uint64_t a = g() % n;
+        const uint64_t b = g() % n;
+        const uint64_t d = g();
+        const Montgomery m(n);
+        ASSERT_EQ(mulmod(a, b, n),         m.from(m.mul(m.to(a), m.to(b))));
+        ASSERT_EQ(powmod(a, d, n),         m.from(m.pow(m.to(a), d)));
+        ASSERT_EQ((a >= n - b) ? a - (n - b) : a + b, m.from(m.add(m.to(a), m.to(b))));}}
+
+TEST(MontgomeryFixture, test_4) {
+    const uint64_t n = 18446744073709551557ULL;                          // 2^64 - 59
+    const Montgomery m(n);
+    ASSERT_EQ(n - 1, m.from(m.to(n - 1)));
+    ASSERT_EQ(1u,    m.from(m.mul(m.to(n - 1), m.to(n - 1))));
+    ASSERT_EQ(1u,    m.from(m.pow(m.to(2), n - 1)));}
@@ -0,0 +1,88 @@
+// ------------
+// Montgomery.h
+// ------------
+
+#ifndef Montgomery_h
+#define Montgomery_h
+
+#include <cstdint> // uint64_t
+
+#include "IsPrime3.h" // uint128_t
+
+/*
+arithmetic mod an odd n < 2^64 without division
+a is kept as a * 2^64 mod n, and a product is brought back to that form
+by REDC, which costs two multiplies and a subtract instead of a 128 bit %
+https://en.wikipedia.org/wiki/Montgomery_modular_multiplication
+*/
+
+// ----------
+// Montgomery
+// ----------
+
+class Montgomery {
+    private:
+        std::uint64_t _n;           // the modulus, odd
+        std::uint64_t _i;           // n^-1 mod 2^64
+        std::uint64_t _r;           // 2^128 mod n
+
+        static std::uint64_t inverse (std::uint64_t n) {
+            std::uint64_t x = n;                        // correct to 3 bits
+            for (int i = 0; i != 5; ++i)
+                x *= 2 - n * x;                         // doubles the bits
+            return x;}
+
+    public:
+        /**
+         * n must be odd
+         */
+        explicit Montgomery (std::uint64_t n) :
+                _n (n),
+                _i (inverse(n)),
+                _r (static_cast<std::uint64_t>((static_cast<uint128_t>(-1) % n + 1) % n))
+            {}
+
+        std::uint64_t modulus () const {
+            return _n;}
+
+        // ------
+        // reduce
+        // ------
+
+        /**
+         * t / 2^64 mod n, t < n * 2^64
+         */
+        std::uint64_t reduce (uint128_t t) const {
+            const std::uint64_t m = static_cast<std::uint64_t>(t) * _i;
+            const std::uint64_t h = static_cast<std::uint64_t>(t >> 64);
+            const std::uint64_t u = static_cast<std::uint64_t>((static_cast<uint128_t>(m) * _n) >> 64);
+            return (h < u) ? h - u + _n : h - u;}
+
+        std::uint64_t to (std::uint64_t a) const {
+            return reduce(static_cast<uint128_t>(a % _n) * _r);}
+
+        std::uint64_t from (std::uint64_t a) const {
+            return reduce(a);}
+
+        std::uint64_t one () const {
+            return to(1);}
+
+        std::uint64_t mul (std::uint64_t a, std::uint64_t b) const {
+            return reduce(static_cast<uint128_t>(a) * b);}
+
+        std::uint64_t add (std::uint64_t a, std::uint64_t b) const {
+            return (a >= _n - b) ? a - (_n - b) : a + b;}
+
+        std::uint64_t sub (std::uint64_t a, std::uint64_t b) const {
+            return (a >= b) ? a - b : a + (_n - b);}
+
+        std::uint64_t pow (std::uint64_t a, std::uint64_t d) const {
+            std::uint64_t r = one();
+            while (d != 0) {
+                if (d & 1)
+                    r = mul(r, a);
+                a = mul(a, a);
+                d >>= 1;}
+            return r;}};
+
+#endif // Montgomery_h
@@ -0,0 +1,55 @@
+// ---------------
+// ParallelFor.c++
+// ---------------
+
+// https://en.wikipedia.org/wiki/Work_stealing
+
+#include <atomic>  // atomic
+#include <chrono>  // milliseconds
+#include <cstdint> // uint64_t
+#include <thread>  // this_thread
+#include <vector>  // vector
+
+#include "gtest/gtest.h"
+
+#include "IsPrime3.h"
+#include "ParallelFor.h"
+#include "Range.h"
+
+using namespace std;
+
+TEST(ParallelForFixture, test_1) {
+    int c = 0;
+    parallel_for(Range<int>(5, 5), [&c] (int) {++c;}, 1, 4);
+    ASSERT_EQ(0, c);}
+
+TEST(ParallelForFixture, test_2) {
+    atomic<long> s(0);
+    parallel_for(Range<int>(0, 100000), [&s] (int i) {s += i;}, 1000, 4);
+    ASSERT_EQ(4999950000L, s.load());}
+
+TEST(ParallelForFixture, test_3) {
+    vector<char> x(10007, 0);
+    parallel_for(Range<int>(0, 10007), [&x] (int i) {++x[i];}, 1, 8);
+    for (char c : x)
+        ASSERT_EQ(1, c);}
+
+TEST(ParallelForFixture, test_4) {
+    vector<char> x(1000, 0);
+    parallel_for(Range<int>(0, 1000), [&x] (int i) {++x[i];}, 0, 1);
+    for (char c : x)
+        ASSERT_EQ(1, c);}
+
+TEST(ParallelForFixture, test_5) {
+    atomic<int> c(0);
+    parallel_for(Range<uint64_t>(0, 1000000), [&c] (uint64_t n) {if (is_prime(n)) ++c;}, 256, 4);
+    ASSERT_EQ(78498, c.load());}
+
+TEST(ParallelForFixture, test_6) {
+    // a few expensive indices at the start, all owned by one thread at first
+    atomic<int> c(0);
+    parallel_for(Range<int>(0, 64), [&c] (int i) {
+        if (i < 4)
+            this_thread::sleep_for(chrono::milliseconds(20));
+        ++c;}, 1, 4);
+    ASSERT_EQ(64, c.load());}
@@ -0,0 +1,114 @@
+// -------------
+// ParallelFor.h
+// -------------
+
+#ifndef ParallelFor_h
+#define ParallelFor_h
+
+#include <algorithm> // max
+#include <atomic>    // atomic
+#include <cstddef>   // ptrdiff_t, size_t
+#include <cstdint>   // uint32_t
+#include <deque>     // deque
+#include <memory>    // unique_ptr
+#include <mutex>     // lock_guard, mutex
+#include <thread>    // thread, yield
+#include <vector>    // vector
+
+#include "Range.h"
+
+/*
+a work-stealing parallel for over a Range
+each worker owns a deque of ranges; it splits a range in half until it
+is no bigger than the grain, pushing the upper halves onto the back of
+its deque, runs the body on what is left, and pops the next range from
+the back, so its own work stays small and local
+an idle worker steals from the front of a random victim's deque, which
+holds the oldest and therefore largest ranges, so a few steals balance
+loops whose iterations cost very different amounts
+*/
+
+// ----------
+// Work_Deque
+// ----------
+
+template <typename T>
+class Work_Deque {
+    private:
+        std::mutex           _m;
+        std::deque<Range<T>> _q;
+
+    public:
+        Work_Deque () :
+                _m (),
+                _q ()
+            {}
+
+        void push (const Range<T>& r) {
+            std::lock_guard<std::mutex> g(_m);
+            _q.push_back(r);}
+
+        bool pop (Range<T>& r) {
+            std::lock_guard<std::mutex> g(_m);
+            if (_q.empty())
+                return false;
+            r = _q.back();
+            _q.pop_back();
+            return true;}
+
+        bool steal (Range<T>& r) {
+            std::lock_guard<std::mutex> g(_m);
+            if (_q.empty())
+                return false;
+            r = _q.front();
+            _q.pop_front();
+            return true;}};
+
+// ------------
+// parallel_for
+// ------------
+
+/**
+ * f(i) for each i in x, on t threads, in no particular order
+ * ranges of g or fewer indices are not split
+ */
+template <typename T, typename F>
+void parallel_for (const Range<T>& x, F f, std::ptrdiff_t g = 1, unsigned t = std::thread::hardware_concurrency()) {
+    g = std::max<std::ptrdiff_t>(g, 1);
+    t = std::max(t, 1u);
+    if (x.size() <= 0)
+        return;
+    std::vector<std::unique_ptr<Work_Deque<T>>> q;
+    for (unsigned i = 0; i != t; ++i)
+        q.emplace_back(new Work_Deque<T>());
+    q[0]->push(x);
+    std::atomic<std::ptrdiff_t> n(x.size());            // indices not yet run
+
+    const auto w = [&] (unsigned k) {
+        std::uint32_t s = 2463534242u + k;             // xorshift, for picking a victim
+        Range<T> r = x;
+        while (n.load(std::memory_order_acquire) != 0) {
+            bool b = q[k]->pop(r);
+            for (unsigned i = 0; !b && (i != t); ++i) {
+                s ^= s << 13;
+                s ^= s >> 17;
+                s ^= s << 5;
+                const unsigned v = s % t;
+                b = (v != k) && q[v]->steal(r);}
+            if (!b) {
+                std::this_thread::yield();
+                continue;}
+            while (r.size() > g)
+                q[k]->push(r.split());
+            for (typename Range<T>::iterator p = r.begin(), e = r.end(); p != e; ++p)
+                f(*p);
+            n.fetch_sub(r.size(), std::memory_order_release);}};
+
+    std::vector<std::thread> v;
+    for (unsigned i = 1; i < t; ++i)
+        v.push_back(std::thread(w, i));
+    w(0);
+    for (std::size_t i = 0; i != v.size(); ++i)
+        v[i].join();}
+
+#endif // ParallelFor_h
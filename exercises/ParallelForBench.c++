@@ -0,0 +1,72 @@
+// --------------------
+// ParallelForBench.c++
+// --------------------
+
+#include <atomic>  // atomic
+#include <cmath>   // sqrt
+#include <cstdint> // uint64_t
+#include <cstdio>  // printf
+#include <thread>  // hardware_concurrency, thread
+#include <vector>  // vector
+
+#include "Bench.h"
+#include "ParallelFor.h"
+#include "Range.h"
+
+// uniform: the same work for every index
+int uniform (std::uint64_t n) {
+    double s = 0;
+    for (int i = 1; i != 200; ++i)
+        s += std::sqrt(static_cast<double>(n + i));
+    return static_cast<int>(s) & 1;}
+
+// skewed: the cycle length of n, irregular from one n to the next
+int collatz (std::uint64_t n) {
+    int c = 1;
+    for (; n != 1; ++c)
+        n = (n & 1) ? (3 * n + 1) : (n / 2);
+    return c;}
+
+// skewed: trial division, cheap for most n, about sqrt(n) for primes, growing with n
+int trial (std::uint64_t n) {
+    if (n < 2)
+        return 0;
+    for (std::uint64_t i = 2; (i * i) <= n; ++i)
+        if ((n % i) == 0)
+            return 0;
+    return 1;}
+
+// t threads, each with one contiguous block
+template <typename F>
+int static_for (const Range<std::uint64_t>& x, F f, unsigned t) {
+    std::atomic<int> c(0);
+    std::vector<std::thread> v;
+    const std::uint64_t b = *x.begin();
+    const std::uint64_t n = x.size();
+    for (unsigned k = 0; k != t; ++k)
+        v.push_back(std::thread([&, k] () {
+            int d = 0;
+            for (std::uint64_t i = b + n * k / t; i != b + n * (k + 1) / t; ++i)
+                d += f(i);
+            c += d;}));
+    for (std::thread& w : v)
+        w.join();
+    return c;}
+
+template <typename F>
+void row (const char* s, const Range<std::uint64_t>& x, F f, unsigned t) {
+    std::atomic<int> c(0);
+    const double t1 = bench([&] () {int d = 0; for (std::uint64_t i : x) d += f(i); do_not_optimize(d);}, 3);
+    const double t2 = bench([&] () {do_not_optimize(static_for(x, f, t));}, 3);
+    const double t3 = bench([&] () {parallel_for(x, [&] (std::uint64_t i) {if (f(i)) c.fetch_add(1, std::memory_order_relaxed);}, 64,   t);}, 3);
+    const double t4 = bench([&] () {parallel_for(x, [&] (std::uint64_t i) {if (f(i)) c.fetch_add(1, std::memory_order_relaxed);}, 4096, t);}, 3);
+    printf("%10s %9.3fs %9.3fs %9.3fs %9.3fs\n", s, t1, t2, t3, t4);}
+
+int main () {
+    using namespace std;
+    const unsigned t = max(1u, thread::hardware_concurrency());
+    printf("%u threads\n%10s %10s %10s %10s %10s\n", t, "cost", "serial", "static", "grain 64", "grain 4096");
+    row("uniform", Range<uint64_t>(1, 1000000),  uniform, t);
+    row("collatz", Range<uint64_t>(1, 3000000),  collatz, t);
+    row("trial",   Range<uint64_t>(1, 3000000),  trial,   t);
+    return 0;}
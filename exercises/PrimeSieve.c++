@@ -0,0 +1,50 @@
+// --------------
+// PrimeSieve.c++
+// --------------
+
+// https://en.wikipedia.org/wiki/Sieve_of_Eratosthenes
+
+#include <cstdint> // uint64_t
+#include <vector>  // vector
+
+#include "gtest/gtest.h"
+
+#include "IsPrime3.h"
+#include "PrimeSieve.h"
+
+using namespace std;
+
+TEST(PrimeSieveFixture, test_1) {
+    Prime_Sieve x;
+    ASSERT_FALSE(x.is_prime( 0));
+    ASSERT_FALSE(x.is_prime( 1));
+    ASSERT_TRUE (x.is_prime( 2));
+    ASSERT_TRUE (x.is_prime( 3));
+    ASSERT_FALSE(x.is_prime( 4));
+    ASSERT_FALSE(x.is_prime( 9));
+    ASSERT_FALSE(x.is_prime(27));
+    ASSERT_TRUE (x.is_prime(29));}
+
+TEST(PrimeSieveFixture, test_2) {
+    Prime_Sieve x;
+    const uint64_t s = Prime_Sieve::S;
+    ASSERT_EQ(s, x.limit());
+    ASSERT_EQ(s / 16, x.bytes());
+    ASSERT_TRUE(x.is_prime(10000019));
+    ASSERT_LE(10000020u, x.limit());
+    ASSERT_EQ(0u, x.limit() % s);}
+
+TEST(PrimeSieveFixture, test_3) {
+    Prime_Sieve x(3 * Prime_Sieve::S);
+    int c = 0;
+    for (uint64_t n = 0; n != x.limit(); ++n) {
+        ASSERT_EQ(is_prime(n), static_cast<const Prime_Sieve&>(x).is_prime(n)) << n;
+        c += is_prime(n);}
+    ASSERT_EQ(226549, c);}
+
+TEST(PrimeSieveFixture, test_4) {
+    Prime_Sieve            x;
+    const vector<uint64_t> a = {2, 4, 29, 33554393, 33554395, 1};
+          vector<bool>     b(a.size());
+    x.is_prime(begin(a), end(a), begin(b));
+    ASSERT_EQ(vector<bool>({true, false, true, true, false, false}), b);}
@@ -0,0 +1,117 @@
+// ------------
+// PrimeSieve.h
+// ------------
+
+#ifndef PrimeSieve_h
+#define PrimeSieve_h
+
+#include <algorithm> // max
+#include <cstddef>   // size_t
+#include <cstdint>   // uint64_t
+#include <vector>    // vector
+
+// -----------
+// Prime_Sieve
+// -----------
+
+/*
+a bit packed sieve of the odd numbers, bit i is set if 2i + 1 is prime
+the sieve is extended one segment at a time, only as far as the largest
+query so far, and then every query is a single bit test
+a query past the end extends the sieve, so only a const sieve may be
+shared between threads
+*/
+
+class Prime_Sieve {
+    public:
+        static const std::uint64_t S = std::uint64_t(1) << 20;  // numbers per segment
+
+    private:
+        std::vector<std::uint64_t> _b;
+        std::uint64_t              _n;                          // [0, _n) is sieved
+
+        bool bit (std::uint64_t n) const {
+            const std::uint64_t i = n / 2;
+            return (_b[i / 64] >> (i % 64)) & 1;}
+
+        void sieve (std::uint64_t lo, std::uint64_t hi) {
+            for (std::uint64_t p = 3; (p * p) < hi; p += 2) {
+                if (!bit(p))
+                    continue;
+                std::uint64_t m = std::max(p * p, (lo + p - 1) / p * p);
+                if ((m % 2) == 0)
+                    m += p;
+                for (; m < hi; m += 2 * p) {
+                    const std::uint64_t i = m / 2;
+                    _b[i / 64] &= ~(std::uint64_t(1) << (i % 64));}}}
+
+    public:
+        explicit Prime_Sieve (std::uint64_t n = S) :
+                _b (),
+                _n (0) {
+            extend(n);}
+
+        // ------
+        // extend
+        // ------
+
+        /**
+         * sieve [0, n), rounded up to a whole segment
+         */
+        void extend (std::uint64_t n) {
+            if (n <= _n)
+                return;
+            const std::uint64_t m = (n + S - 1) / S * S;
+            _b.resize(m / 128, ~std::uint64_t(0));
+            if (_n == 0)
+                _b[0] &= ~std::uint64_t(1);                     // 1 is not prime
+            for (; _n != m; _n += S)
+                sieve(_n, _n + S);}
+
+        // --------
+        // is_prime
+        // --------
+
+        bool is_prime (std::uint64_t n) {
+            if (n >= _n)
+                extend(n + 1);
+            return static_cast<const Prime_Sieve&>(*this).is_prime(n);}
+
+        /**
+         * n must be less than limit()
+         */
+        bool is_prime (std::uint64_t n) const {
+            if ((n % 2) == 0)
+                return n == 2;
+            return bit(n);}
+
+        /**
+         * write is_prime(*b) for each element of [b, e) to x
+         * the sieve is extended once, to the largest value
+         */
+        template <typename FI, typename OI>
+        OI is_prime (FI b, FI e, OI x) {
+            std::uint64_t m = 0;
+            for (FI i = b; i != e; ++i)
+                m = std::max<std::uint64_t>(m, *i);
+            extend(m + 1);
+            const Prime_Sieve& s = *this;
+            for (; b != e; ++b, ++x)
+                *x = s.is_prime(*b);
+            return x;}
+
+        // -----
+        // limit
+        // -----
+
+        std::uint64_t limit () const {
+            return _n;}
+
+        // -----
+        // bytes
+        // -----
+
+        std::size_t bytes () const {
+            return _b.size() * sizeof(std::uint64_t);}};
+
+#endif // PrimeSieve_h
@@ -0,0 +1,57 @@
+// -------------------
+// PrimeSieveBench.c++
+// -------------------
+
+#include <cmath>   // sqrt
+#include <cstdint> // uint64_t
+#include <cstdio>  // printf
+#include <cstdlib> // atoi
+#include <random>  // mt19937_64, uniform_int_distribution
+#include <vector>  // vector
+
+#include "Bench.h"
+#include "IsPrime3.h"
+#include "PrimeSieve.h"
+
+// IsPrime2
+bool is_prime_trial (std::uint64_t n) {
+    if (n == 2)
+        return true;
+    if ((n == 1) || ((n % 2) == 0))
+        return false;
+    for (std::uint64_t i = 3; i <= std::sqrt(n); i += 2)
+        if ((n % i) == 0)
+            return false;
+    return true;}
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const uint64_t m = (argc > 1) ? atoi(argv[1]) : 1000000000;
+    const int      q = 1000000;
+
+    printf("%12s %10s %10s %14s\n", "limit", "build", "MB", "bytes/number");
+    for (uint64_t n = 1000000; n <= m; n *= 10) {
+        Prime_Sieve* p = nullptr;
+        const double t = bench([&] () {delete p; p = new Prime_Sieve(n);}, 1);
+        printf("%12llu %9.3fs %10.2f %14.4f\n", static_cast<unsigned long long>(n), t, p->bytes() / 1e6, static_cast<double>(p->bytes()) / p->limit());
+        delete p;}
+
+    mt19937_64 g(1);
+    uniform_int_distribution<uint64_t> u(1, m);
+    vector<uint64_t> x(q);
+    for (int i = 0; i != q; ++i)
+        x[i] = u(g);
+    vector<char> y(q);
+
+    Prime_Sieve s;
+    const double t0 = bench([&] () {s.extend(m);}, 1);
+    const double t1 = bench([&] () {int c = 0; for (int i = 0; i != q; ++i) c += is_prime_trial(x[i]); do_not_optimize(c);}, 1);
+    const double t2 = bench([&] () {int c = 0; for (int i = 0; i != q; ++i) c += is_prime(x[i]);       do_not_optimize(c);}, 3);
+    const double t3 = bench([&] () {int c = 0; for (int i = 0; i != q; ++i) c += s.is_prime(x[i]);     do_not_optimize(c);}, 3);
+    const double t4 = bench([&] () {s.is_prime(begin(x), end(x), begin(y));                               do_not_optimize(y[0]);}, 3);
+    printf("\n%d queries below %llu, sieve built in %.3fs\n", q, static_cast<unsigned long long>(m), t0);
+    printf("%20s %10.1fns\n", "trial division",      t1 * 1e9 / q);
+    printf("%20s %10.1fns\n", "miller-rabin",        t2 * 1e9 / q);
+    printf("%20s %10.1fns\n", "sieve",               t3 * 1e9 / q);
+    printf("%20s %10.1fns\n", "sieve, batch",        t4 * 1e9 / q);
+    return 0;}
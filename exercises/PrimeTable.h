@@ -0,0 +1,88 @@
+// ------------
+// PrimeTable.h
+// ------------
+
+#ifndef PrimeTable_h
+#define PrimeTable_h
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+
+#include "IndexList.h"
+
+/*
+a bitset of the odd primes below 2^K, built by the compiler
+one bit per odd number, so 2^K / 16 bytes, 4 KB for K = 16
+each word is a constant expression computed by trial division,
+so the table lives in read-only data and costs nothing at run time
+the compiler pays instead, a few seconds for K = 18, more for K = 20
+*/
+
+#ifndef PRIME_TABLE_BITS
+#define PRIME_TABLE_BITS 16
+#endif
+
+// ---------------
+// odd_prime_trial
+// ---------------
+
+/*
+n has no factor below d, d == 5 mod 6
+tries d and d + 2, then moves on to the next 6k - 1
+*/
+
+constexpr bool odd_prime_trial (std::uint64_t n, std::uint64_t d) {
+    return ((d * d) > n) || (((n % d) != 0) && ((n % (d + 2)) != 0) && odd_prime_trial(n, d + 6));}
+
+// ------------
+// is_odd_prime
+// ------------
+
+/*
+n odd
+*/
+
+constexpr bool is_odd_prime (std::uint64_t n) {
+    return (n < 5) ? (n == 3) : ((n % 3) != 0) && odd_prime_trial(n, 5);}
+
+// --------------
+// odd_prime_word
+// --------------
+
+/*
+bit j of word i is the odd number 128 * i + 2 * j + 1
+*/
+
+constexpr std::uint64_t odd_prime_word (std::size_t i, unsigned j = 0) {
+    return (j == 64) ?
+        0 :
+        (static_cast<std::uint64_t>(is_odd_prime(128 * i + 2 * j + 1)) << j) | odd_prime_word(i, j + 1);}
+
+// -----------
+// Prime_Table
+// -----------
+
+template <unsigned K, typename = typename make_index_list<(std::size_t(1) << K) / 128>::type>
+struct Prime_Table;
+
+template <unsigned K, std::size_t... I>
+struct Prime_Table<K, index_list<I...>> {
+    static_assert((K >= 7) && (K <= 20), "K must be in [7, 20]");
+
+    static constexpr std::uint64_t bound = std::uint64_t(1) << K;
+
+    static constexpr std::uint64_t bits[sizeof...(I)] = {odd_prime_word(I)...};
+
+    /**
+     * n must be less than bound
+     */
+    static constexpr bool test (std::uint64_t n) {
+        return (n == 2) || ((n & 1) && ((bits[n >> 7] >> ((n >> 1) & 63)) & 1));}};
+
+template <unsigned K, std::size_t... I>
+constexpr std::uint64_t Prime_Table<K, index_list<I...>>::bound;
+
+template <unsigned K, std::size_t... I>
+constexpr std::uint64_t Prime_Table<K, index_list<I...>>::bits[sizeof...(I)];
+
+#endif // PrimeTable_h
@@ -2,7 +2,9 @@
 // RMSE.c++
 // --------
 
+#include <cmath>      // abs, sqrt
 #include <functional> // function
+#include <iterator>   // begin, end
 #include <list>       // list
 #include <vector>     // vector
 
@@ -24,7 +26,13 @@ INSTANTIATE_TEST_CASE_P(
     Values(
         rmse_while<list<double>::const_iterator, vector<double>::const_iterator, double>,
         rmse_transform_accumulate<list<double>::const_iterator, vector<double>::const_iterator, double>,
-        rmse_back_inserter<list<double>::const_iterator, vector<double>::const_iterator, double>));
+        rmse_back_inserter<list<double>::const_iterator, vector<double>::const_iterator, double>,
+        rmse_fused<list<double>::const_iterator, vector<double>::const_iterator, double>,
+        rmse_view<list<double>::const_iterator, vector<double>::const_iterator, double>,
+        rmse_sum<naive_sum,    list<double>::const_iterator, vector<double>::const_iterator, double>,
+        rmse_sum<pairwise_sum, list<double>::const_iterator, vector<double>::const_iterator, double>,
+        rmse_sum<kahan_sum,    list<double>::const_iterator, vector<double>::const_iterator, double>,
+        rmse_sum<wide_sum,     list<double>::const_iterator, vector<double>::const_iterator, double>));
 
 TEST_P(RMSEListFixture, test_1) {
     const list<double>   x = {2, 3, 4};
@@ -45,3 +53,73 @@ TEST_P(RMSEListFixture, test_4) {
     const list<double>   x = {2, 3, 4};
     const vector<double> y = {4, 3, 2};
 	ASSERT_FLOAT_EQ(1.6329932, GetParam()(begin(x), end(x), begin(y), 0.0));}
+
+using RMSEArraySignature = function<double (const double*, const double*, const double*, double)>;
+
+struct RMSEArrayFixture : TestWithParam<RMSEArraySignature>
+    {};
+
+INSTANTIATE_TEST_CASE_P(
+    RMSEArrayInstantiation,
+    RMSEArrayFixture,
+    Values(
+        rmse_while<const double*, const double*, double>,
+        rmse_fused<const double*, const double*, double>,
+        rmse_view<const double*, const double*, double>,
+        rmse_unrolled<double>,
+        rmse_sum<naive_sum,    const double*, const double*, double>,
+        rmse_sum<pairwise_sum, const double*, const double*, double>,
+        rmse_sum<kahan_sum,    const double*, const double*, double>,
+        rmse_sum<wide_sum,     const double*, const double*, double>));
+
+TEST_P(RMSEArrayFixture, test_1) {
+    const double a[] = {2, 3, 4};
+    const double b[] = {4, 3, 2};
+    ASSERT_FLOAT_EQ(1.6329932, GetParam()(begin(a), end(a), begin(b), 0.0));}
+
+TEST_P(RMSEArrayFixture, test_2) {
+    const double a[] = {2};
+    ASSERT_FLOAT_EQ(3, GetParam()(a, a, a, 3.0));}
+
+TEST_P(RMSEArrayFixture, test_3) {
+    vector<double> x(1001);
+    vector<double> y(1001);
+    for (int i = 0; i != 1001; ++i) {
+        x[i] = i;
+        y[i] = i + ((i % 2) ? 2 : -2);}
+    ASSERT_FLOAT_EQ(2, GetParam()(x.data(), x.data() + x.size(), y.data(), 0.0));}
+
+TEST(RMSEFloatFixture, test_1) {
+    vector<float> x(1001);
+    vector<float> y(1001);
+    for (int i = 0; i != 1001; ++i) {
+        x[i] = i;
+        y[i] = i + 3;}
+    ASSERT_FLOAT_EQ(3, rmse_unrolled(x.data(), x.data() + x.size(), y.data(), 0.0f));}
+
+TEST(RMSEFloatFixture, test_2) {
+    const int     n = 1000000;
+    vector<float> x(n, 0.1f);
+    vector<float> y(n, 0);
+    const float   v = sqrt(0.1f * 0.1f);
+    ASSERT_NEAR    (v, rmse_sum<pairwise_sum>(x.data(), x.data() + n, y.data(), 0.0f), v * 1e-6);
+    ASSERT_FLOAT_EQ(v, rmse_sum<kahan_sum>   (x.data(), x.data() + n, y.data(), 0.0f));
+    ASSERT_GT(abs(v - rmse_sum<naive_sum>(x.data(), x.data() + n, y.data(), 0.0f)), v * 1e-4);}
+
+TEST(RMSEFloatFixture, test_3) {
+    const int     n = 1000000;
+    list<float>   x(n, 0.1f);
+    vector<float> y(n, 0);
+    const float   v = sqrt(0.1f * 0.1f);
+    ASSERT_NEAR    (v, rmse_sum<pairwise_sum>(begin(x), end(x), begin(y), 0.0f), v * 1e-6);
+    ASSERT_FLOAT_EQ(v, rmse_sum<kahan_sum>   (begin(x), end(x), begin(y), 0.0f));
+    ASSERT_NEAR    (v, rmse_sum<wide_sum>    (begin(x), end(x), begin(y), 0.0f), v * 1e-3);}
+
+TEST(RMSEDoubleFixture, test_1) {
+    const int      n = 1000000;
+    vector<double> x(n, 0.1);
+    vector<double> y(n, 0);
+    const double   v = sqrt(0.1 * 0.1);
+    ASSERT_NEAR     (v, rmse_sum<pairwise_sum>(x.data(), x.data() + n, y.data(), 0.0), v * 1e-14);
+    ASSERT_DOUBLE_EQ(v, rmse_sum<kahan_sum>   (x.data(), x.data() + n, y.data(), 0.0));
+    ASSERT_NEAR     (v, rmse_sum<wide_sum>    (x.data(), x.data() + n, y.data(), 0.0), v * 1e-12);}
@@ -2,12 +2,18 @@
 // RMSE.c++
 // --------
 
-#include <algorithm> // transform
-#include <cmath>     // sqrt
-#include <cstddef>   // ptrdiff_t
-#include <iterator>  // back_inserter, distance
-#include <list>      // list
-#include <numeric>   // accumulate
+#ifndef RMSE_h
+#define RMSE_h
+
+#include <algorithm>   // transform
+#include <cmath>       // sqrt
+#include <cstddef>     // ptrdiff_t, size_t
+#include <iterator>    // back_inserter, distance, iterator_traits
+#include <list>        // list
+#include <numeric>     // accumulate
+#include <type_traits> // conditional, is_base_of, is_floating_point
+
+#include "View.h"
 
 template <typename II1, typename II2, typename T>
 T rmse_while (II1 b, II1 e, II2 c, T v) {
@@ -50,3 +56,250 @@ T rmse_back_inserter (II1 b, II1 e, II2 c, T v) {
     v = std::accumulate(begin(x), end(x), v);
 
     return std::sqrt(v / x.size());}
+
+/*
+one pass, no allocation
+the size is counted along the way, so a list is only walked once
+*/
+
+template <typename II1, typename II2, typename T>
+T rmse_fused (II1 b, II1 e, II2 c, T v) {
+    if (b == e)
+        return v;
+
+    std::ptrdiff_t s = 0;
+
+    while (b != e) {
+        const T d = (*b - *c);
+        v += (d * d);
+        ++b;
+        ++c;
+        ++s;}
+
+    return std::sqrt(v / s);}
+
+/*
+the transform and the accumulate of rmse_transform_accumulate,
+composed as a lazy view, so they fuse into one loop with no list
+*/
+
+template <typename II1, typename II2, typename T>
+T rmse_view (II1 b, II1 e, II2 c, T v) {
+    if (b == e)
+        return v;
+
+    std::ptrdiff_t s = 0;
+
+    v = zip(b, e, c)
+        .transform([] (T a, T p) -> T {const T d = a - p; return (d * d);})
+        .reduce(v, [&s] (T v, T d) -> T {++s; return v + d;});
+
+    return std::sqrt(v / s);}
+
+/*
+contiguous float or double
+one accumulator per lane of a 64 byte block breaks the serial dependency
+on v, so the loop vectorizes without reassociating a single sum
+*/
+
+template <typename T>
+T rmse_unrolled (const T* b, const T* e, const T* c, T v) {
+    static_assert(std::is_floating_point<T>::value, "T must be a floating point type");
+    if (b == e)
+        return v;
+
+    const std::size_t    N = 64 / sizeof(T);
+    const std::ptrdiff_t s = e - b;
+
+    T a[N] = {};
+    while (static_cast<std::size_t>(e - b) >= N) {
+        for (std::size_t i = 0; i != N; ++i) {
+            const T d = (b[i] - c[i]);
+            a[i] += (d * d);}
+        b += N;
+        c += N;}
+    for (std::size_t i = 0; b != e; ++i) {
+        const T d = (*b - *c);
+        a[i] += (d * d);
+        ++b;
+        ++c;}
+
+    for (std::size_t n = N / 2; n != 0; n /= 2)
+        for (std::size_t i = 0; i != n; ++i)
+            a[i] += a[i + n];
+    v += a[0];
+
+    return std::sqrt(v / s);}
+
+// ---------
+// summation
+// ---------
+
+/*
+strategies for the sum of the squared differences, selected by rmse_sum
+each one adds the squares of [b, e) - [c, ...) to v and counts them in s
+
+naive_sum    : one accumulator, a serial dependency, error grows with n
+pairwise_sum : blocks summed in registers, then combined pairwise, error grows with log n
+kahan_sum    : compensated sum (Neumaier), error independent of n, slowest
+wide_sum     : one accumulator per lane, vectorizes, error grows with n / lanes
+*/
+
+struct naive_sum {
+    template <typename II1, typename II2, typename T>
+    static T sum (II1 b, II1 e, II2 c, T v, std::ptrdiff_t& s) {
+        while (b != e) {
+            const T d = (*b - *c);
+            v += (d * d);
+            ++b;
+            ++c;
+            ++s;}
+        return v;}};
+
+struct pairwise_sum {
+    static const std::size_t B = 128;
+
+    template <typename II1, typename II2, typename T>
+    static T sum (II1 b, II1 e, II2 c, T v, std::ptrdiff_t& s) {
+        T           a[64];                // partial sums, a[i] covers 2^j[i] blocks
+        std::size_t j[64];
+        std::size_t n = 0;
+        while (b != e) {
+            T w = T();
+            for (std::size_t i = 0; (i != B) && (b != e); ++i) {
+                const T d = (*b - *c);
+                w += (d * d);
+                ++b;
+                ++c;
+                ++s;}
+            std::size_t k = 0;
+            while ((n != 0) && (j[n - 1] == k)) {
+                w = a[n - 1] + w;
+                ++k;
+                --n;}
+            a[n] = w;
+            j[n] = k;
+            ++n;}
+        T w = T();
+        while (n != 0) {
+            w = a[n - 1] + w;
+            --n;}
+        return v + w;}};
+
+struct kahan_sum {
+    static const std::size_t B = 64;
+
+    // s + e == a + b exactly
+    template <typename T>
+    static T two_sum (T a, T b, T& e) {
+        const T s = a + b;
+        const T z = s - a;
+        e = (a - (s - z)) + (b - z);
+        return s;}
+
+    template <typename II1, typename II2, typename T>
+    static T sum (II1 b, II1 e, II2 c, T v, std::ptrdiff_t& s) {
+        T r = T();
+        T q;
+        std::size_t i = 0;
+        while (b != e) {
+            const T d = (*b - *c);
+            v = two_sum(v, d * d, q);
+            r += q;
+            if (++i == B) {                // fold the compensation back in, so that it stays small
+                v = two_sum(v, r, r);
+                i = 0;}
+            ++b;
+            ++c;
+            ++s;}
+        return v + r;}};
+
+// ----------
+// wide_lanes
+// ----------
+
+/*
+the lane kernel of wide_sum, for any accumulator L of L::N lanes
+each (a, p) goes to L::add(i, a, p), lane i = k % L::N for the k-th pair,
+so the lanes are independent and the loop over a block vectorizes
+returns the number of pairs
+*/
+
+template <typename L, typename RI1, typename RI2>
+std::ptrdiff_t wide_lanes (RI1 b, RI1 e, RI2 c, L& l, std::random_access_iterator_tag) {
+    const std::ptrdiff_t s = (e - b);
+    while (static_cast<std::size_t>(e - b) >= L::N) {
+        for (std::size_t i = 0; i != L::N; ++i)
+            l.add(i, b[i], c[i]);
+        b += L::N;
+        c += L::N;}
+    for (std::size_t i = 0; b != e; ++i, ++b, ++c)
+        l.add(i, *b, *c);
+    return s;}
+
+template <typename L, typename II1, typename II2>
+std::ptrdiff_t wide_lanes (II1 b, II1 e, II2 c, L& l, std::input_iterator_tag) {
+    std::ptrdiff_t s = 0;
+    for (std::size_t i = 0; b != e; i = (i + 1) % L::N, ++b, ++c, ++s)
+        l.add(i, *b, *c);
+    return s;}
+
+template <typename L, typename II1, typename II2>
+std::ptrdiff_t wide_lanes (II1 b, II1 e, II2 c, L& l) {
+    typedef typename std::conditional<
+            std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<II1>::iterator_category>::value &&
+            std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<II2>::iterator_category>::value,
+            std::random_access_iterator_tag,
+            std::input_iterator_tag>::type category;
+    return wide_lanes(b, e, c, l, category());}
+
+// ------------
+// Square_Lanes
+// ------------
+
+/*
+one sum of squared differences per lane of a 64 byte block
+*/
+
+template <typename T>
+struct Square_Lanes {
+    typedef T value_type;
+
+    static const std::size_t N = 64 / sizeof(T);
+
+    T a[N];
+
+    Square_Lanes () :
+            a ()
+        {}
+
+    void add (std::size_t i, T x, T y) {
+        const T d = (x - y);
+        a[i] += (d * d);}
+
+    // pairwise over the lanes, in place
+    T reduce () {
+        for (std::size_t n = N / 2; n != 0; n /= 2)
+            for (std::size_t i = 0; i != n; ++i)
+                a[i] += a[i + n];
+        return a[0];}};
+
+struct wide_sum {
+    template <typename II1, typename II2, typename T>
+    static T sum (II1 b, II1 e, II2 c, T v, std::ptrdiff_t& s) {
+        Square_Lanes<T> l;
+        s += wide_lanes(b, e, c, l);
+        return v + l.reduce();}};
+
+template <typename S, typename II1, typename II2, typename T>
+T rmse_sum (II1 b, II1 e, II2 c, T v) {
+    if (b == e)
+        return v;
+
+    std::ptrdiff_t s = 0;
+
+    v = S::sum(b, e, c, v, s);
+
+    return std::sqrt(v / s);}
+
+#endif // RMSE_h
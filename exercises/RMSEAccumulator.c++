@@ -0,0 +1,67 @@
+// -------------------
+// RMSEAccumulator.c++
+// -------------------
+
+#include <list>   // list
+#include <thread> // thread
+#include <vector> // vector
+
+#include "gtest/gtest.h"
+
+#include "RMSEAccumulator.h"
+
+using namespace std;
+
+TEST(RMSEAccumulatorFixture, test_1) {
+    const RMSE_Accumulator<double> x;
+    ASSERT_EQ(0, x.size());
+    ASSERT_EQ(0, x.rmse());}
+
+TEST(RMSEAccumulatorFixture, test_2) {
+    RMSE_Accumulator<double> x;
+    x.add(2, 4).add(3, 3).add(4, 2);
+    ASSERT_EQ(3, x.size());
+    ASSERT_EQ(8, x.sum());
+    ASSERT_FLOAT_EQ(1.6329932, x.rmse());}
+
+TEST(RMSEAccumulatorFixture, test_3) {
+    const list<double>   a = {2, 3, 4};
+    const vector<double> p = {4, 1, 6};
+    RMSE_Accumulator<double> x;
+    x.add(begin(a), end(a), begin(p));
+    ASSERT_FLOAT_EQ(2, x.rmse());
+    x.add(begin(a), end(a), begin(p));
+    ASSERT_EQ(6, x.size());
+    ASSERT_FLOAT_EQ(2, x.rmse());}
+
+TEST(RMSEAccumulatorFixture, test_4) {
+    const vector<double> a = {2, 3, 4, 2, 3, 4};
+    const vector<double> p = {4, 3, 2, 3, 2, 5};
+    RMSE_Accumulator<double> x;
+    RMSE_Accumulator<double> y;
+    x.add(begin(a),     begin(a) + 3, begin(p));
+    y.add(begin(a) + 3, end(a),       begin(p) + 3);
+    x.merge(y);
+    ASSERT_EQ(6, x.size());
+    ASSERT_FLOAT_EQ(rmse_while(begin(a), end(a), begin(p), 0.0), x.rmse());}
+
+TEST(RMSEAccumulatorFixture, test_5) {
+    const int      n = 100001;
+    const int      m = 4;
+    vector<double> a(n);
+    vector<double> p(n);
+    for (int i = 0; i != n; ++i) {
+        a[i] = i % 7;
+        p[i] = i % 5;}
+    vector<RMSE_Accumulator<double, kahan_sum>> x(m);
+    vector<thread> t;
+    for (int i = 0; i != m; ++i) {
+        const int b = n / m * i;
+        const int e = (i == m - 1) ? n : (n / m * (i + 1));
+        t.push_back(thread([&, i, b, e] () {x[i].add(a.data() + b, a.data() + e, p.data() + b);}));}
+    for (int i = 0; i != m; ++i)
+        t[i].join();
+    for (int i = 1; i != m; ++i)
+        x[0].merge(x[i]);
+    ASSERT_EQ(n, x[0].size());
+    ASSERT_DOUBLE_EQ(rmse_sum<kahan_sum>(begin(a), end(a), begin(p), 0.0), x[0].rmse());}
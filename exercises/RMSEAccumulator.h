@@ -0,0 +1,59 @@
+// -----------------
+// RMSEAccumulator.h
+// -----------------
+
+#ifndef RMSEAccumulator_h
+#define RMSEAccumulator_h
+
+#include <cmath>   // sqrt
+#include <cstddef> // ptrdiff_t
+
+#include "RMSE.h"
+
+/*
+the count and the sum of squares of a stream of (actual, predicted) pairs
+batches can be added as they arrive, shards can be accumulated
+independently and merged, and the RMSE can be read at any time
+S is the summation strategy used for ranges, see RMSE.h
+*/
+
+template <typename T, typename S = wide_sum>
+class RMSE_Accumulator {
+    private:
+        std::ptrdiff_t _n;
+        T              _v;
+
+    public:
+        RMSE_Accumulator () :
+                _n (0),
+                _v ()
+            {}
+
+        RMSE_Accumulator& add (const T& a, const T& p) {
+            const T d = (a - p);
+            _v += (d * d);
+            ++_n;
+            return *this;}
+
+        template <typename II1, typename II2>
+        RMSE_Accumulator& add (II1 b, II1 e, II2 c) {
+            _v = S::sum(b, e, c, _v, _n);
+            return *this;}
+
+        RMSE_Accumulator& merge (const RMSE_Accumulator& rhs) {
+            _n += rhs._n;
+            _v += rhs._v;
+            return *this;}
+
+        std::ptrdiff_t size () const {
+            return _n;}
+
+        T sum () const {
+            return _v;}
+
+        T rmse () const {
+            if (_n == 0)
+                return T();
+            return std::sqrt(_v / _n);}};
+
+#endif // RMSEAccumulator_h
@@ -0,0 +1,72 @@
+// -------------
+// RMSEBench.c++
+// -------------
+
+#include <cmath>   // abs
+#include <cstdio>  // printf
+#include <cstdlib> // atoi
+#include <random>  // mt19937, uniform_real_distribution
+#include <vector>  // vector
+
+#include "Bench.h"
+#include "RMSE.h"
+
+template <typename T>
+void run (const char* name, int m) {
+    using namespace std;
+    printf("%s\n", name);
+    printf("%10s %12s %12s %12s %12s %12s %12s\n", "n", "while", "transform", "inserter", "fused", "view", "unrolled");
+    for (int n = 1 << 10; n <= m; n <<= 2) {
+        vector<T> x(n);
+        vector<T> y(n);
+        for (int i = 0; i != n; ++i) {
+            x[i] = i % 1000;
+            y[i] = (i + 1) % 1000;}
+        const T* const b = x.data();
+        const T* const e = b + n;
+        const T* const c = y.data();
+        const int      r = (1 << 22) / n + 1;
+        const double t1 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(               rmse_while(b, e, c, T(0)));});
+        const double t2 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(rmse_transform_accumulate(b, e, c, T(0)));});
+        const double t3 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(       rmse_back_inserter(b, e, c, T(0)));});
+        const double t4 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(               rmse_fused(b, e, c, T(0)));});
+        const double t5 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(                rmse_view(b, e, c, T(0)));});
+        const double t6 = bench([&] () {for (int i = 0; i != r; ++i) do_not_optimize(            rmse_unrolled(b, e, c, T(0)));});
+        printf("%10d %10.3fns %10.3fns %10.3fns %10.3fns %10.3fns %10.3fns\n", n,
+            t1 * 1e9 / r / n, t2 * 1e9 / r / n, t3 * 1e9 / r / n, t4 * 1e9 / r / n, t5 * 1e9 / r / n, t6 * 1e9 / r / n);}}
+
+template <typename S, typename T>
+void sum (const char* name, const std::vector<T>& x, const std::vector<T>& y, long double w) {
+    const T* const b = x.data();
+    const T* const e = b + x.size();
+    const T* const c = y.data();
+    T v = 0;
+    const double t = bench([&] () {v = rmse_sum<S>(b, e, c, T(0)); do_not_optimize(v);}, 3);
+    std::printf("%12s %10.3fns %12.3e\n", name, t * 1e9 / x.size(), static_cast<double>(std::abs((v - w) / w)));}
+
+template <typename T>
+void sums (const char* name, int n) {
+    using namespace std;
+    vector<T> x(n);
+    vector<T> y(n);
+    mt19937 g(1);
+    uniform_real_distribution<T> u(0, 1);
+    for (int i = 0; i != n; ++i) {
+        x[i] = u(g);
+        y[i] = x[i] + u(g) / 8;}
+    const long double w = rmse_sum<kahan_sum>(x.data(), x.data() + n, y.data(), 0.0L);
+    printf("%s, n = %d, error relative to a long double reference\n", name, n);
+    printf("%12s %12s %12s\n", "sum", "time", "error");
+    sum<naive_sum>   ("naive",    x, y, w);
+    sum<pairwise_sum>("pairwise", x, y, w);
+    sum<kahan_sum>   ("kahan",    x, y, w);
+    sum<wide_sum>    ("wide",     x, y, w);}
+
+int main (int argc, char* argv[]) {
+    const int m = (argc > 1) ? std::atoi(argv[1]) : (1 << 20);
+    const int n = (argc > 2) ? std::atoi(argv[2]) : 10000000;
+    run<double>("double", m);
+    run<float> ("float",  m);
+    sums<double>("double", n);
+    sums<float> ("float",  n);
+    return 0;}
@@ -0,0 +1,78 @@
+// ------------
+// RMSEFile.c++
+// ------------
+
+#include <cmath>        // sqrt
+#include <cstdio>       // remove
+#include <fstream>      // ofstream
+#include <stdexcept>    // invalid_argument
+#include <string>       // string
+#include <system_error> // system_error
+#include <vector>       // vector
+
+#include <unistd.h>     // sysconf
+
+#include "gtest/gtest.h"
+
+#include "RMSEFile.h"
+
+using namespace std;
+
+template <typename T>
+void write (const string& f, const vector<T>& x) {
+    ofstream w(f, ios::binary);
+    w.write(reinterpret_cast<const char*>(x.data()), x.size() * sizeof(T));}
+
+TEST(RMSEFileFixture, test_1) {
+    write("RMSEFile.a.bin", vector<double>({2, 3, 4}));
+    write("RMSEFile.p.bin", vector<double>({4, 3, 2}));
+    ASSERT_FLOAT_EQ(1.6329932, rmse_file<double>("RMSEFile.a.bin", "RMSEFile.p.bin"));
+    remove("RMSEFile.a.bin");
+    remove("RMSEFile.p.bin");}
+
+TEST(RMSEFileFixture, test_2) {
+    const int      n = 100003;
+    vector<float>  a(n);
+    vector<float>  p(n);
+    for (int i = 0; i != n; ++i) {
+        a[i] = i % 7;
+        p[i] = i % 5;}
+    write("RMSEFile.a.bin", a);
+    write("RMSEFile.p.bin", p);
+    const float v = rmse_sum<kahan_sum>(a.data(), a.data() + n, p.data(), 0.0f);
+    ASSERT_FLOAT_EQ(v, rmse_file<float>("RMSEFile.a.bin", "RMSEFile.p.bin", 1));
+    ASSERT_FLOAT_EQ(v, rmse_file<float>("RMSEFile.a.bin", "RMSEFile.p.bin", 3));
+    ASSERT_FLOAT_EQ(v, rmse_file<float>("RMSEFile.a.bin", "RMSEFile.p.bin", 64));
+    remove("RMSEFile.a.bin");
+    remove("RMSEFile.p.bin");}
+
+TEST(RMSEFileFixture, test_3) {
+    write("RMSEFile.a.bin", vector<double>());
+    write("RMSEFile.p.bin", vector<double>());
+    ASSERT_EQ(0, rmse_file<double>("RMSEFile.a.bin", "RMSEFile.p.bin"));
+    remove("RMSEFile.a.bin");
+    remove("RMSEFile.p.bin");}
+
+TEST(RMSEFileFixture, test_4) {
+    write("RMSEFile.a.bin", vector<double>({2, 3, 4}));
+    write("RMSEFile.p.bin", vector<double>({4, 3}));
+    ASSERT_THROW(rmse_file<double>("RMSEFile.a.bin", "RMSEFile.p.bin"), invalid_argument);
+    remove("RMSEFile.a.bin");
+    remove("RMSEFile.p.bin");}
+
+TEST(RMSEFileFixture, test_5) {
+    ASSERT_THROW(rmse_file<double>("RMSEFile.none.bin", "RMSEFile.none.bin"), system_error);}
+
+TEST(RMSEFileFixture, test_6) {
+    const size_t   g = ::sysconf(_SC_PAGESIZE) / sizeof(double);
+    const unsigned t = 2;
+    const size_t   n = 1 * t * g + 1;                                // n / t is a whole number of pages
+    vector<double> a(n);
+    vector<double> p(n);
+    p[n - 1] = n;
+    write("RMSEFile.a.bin", a);
+    write("RMSEFile.p.bin", p);
+    ASSERT_DOUBLE_EQ(sqrt(double(n)), rmse_file<double>("RMSEFile.a.bin", "RMSEFile.p.bin", 1));
+    ASSERT_DOUBLE_EQ(sqrt(double(n)), rmse_file<double>("RMSEFile.a.bin", "RMSEFile.p.bin", t));
+    remove("RMSEFile.a.bin");
+    remove("RMSEFile.p.bin");}
@@ -0,0 +1,65 @@
+// ----------
+// RMSEFile.h
+// ----------
+
+#ifndef RMSEFile_h
+#define RMSEFile_h
+
+#include <algorithm>   // min
+#include <cstddef>     // size_t
+#include <stdexcept>   // invalid_argument
+#include <string>      // string
+#include <thread>      // thread
+#include <type_traits> // is_floating_point
+#include <vector>      // vector
+
+#include <unistd.h>    // sysconf
+
+#include "MappedFile.h"
+#include "RMSEAccumulator.h"
+
+// ---------
+// rmse_file
+// ---------
+
+/*
+the RMSE of two files of raw T, actual and predicted
+the files are mapped, not read, and split into page aligned chunks,
+one per thread; each chunk is summed with the vectorized kernel and the
+partial sums are merged
+*/
+
+template <typename T>
+T rmse_file (const std::string& a, const std::string& p, unsigned t = std::thread::hardware_concurrency()) {
+    static_assert(std::is_floating_point<T>::value, "T must be a floating point type");
+    const Mapped_File x(a);
+    const Mapped_File y(p);
+    if (x.size() != y.size())
+        throw std::invalid_argument("rmse_file: " + a + " and " + p + " differ in size");
+    if ((x.size() % sizeof(T)) != 0)
+        throw std::invalid_argument("rmse_file: " + a + " is not a whole number of values");
+
+    const std::size_t n = x.size() / sizeof(T);
+    const T* const    b = reinterpret_cast<const T*>(x.data());
+    const T* const    c = reinterpret_cast<const T*>(y.data());
+    if (n == 0)
+        return T();
+
+    const std::size_t g = ::sysconf(_SC_PAGESIZE) / sizeof(T);      // values per page
+    t = std::max(1u, std::min<unsigned>(t, (n + g - 1) / g));
+    const std::size_t s = ((n + t - 1) / t + g - 1) / g * g;        // values per chunk, t * s >= n
+
+    std::vector<RMSE_Accumulator<T>> v(t);
+    std::vector<std::thread>         w;
+    for (unsigned i = 1; i < t; ++i)
+        w.push_back(std::thread([&v, b, c, i, n, s] () {
+            const std::size_t k = std::min(n, i * s);
+            const std::size_t m = std::min(n, k + s);
+            v[i].add(b + k, b + m, c + k);}));
+    v[0].add(b, b + std::min(n, s), c);
+    for (std::size_t i = 0; i != w.size(); ++i) {
+        w[i].join();
+        v[0].merge(v[i + 1]);}
+    return v[0].rmse();}
+
+#endif // RMSEFile_h
@@ -0,0 +1,59 @@
+// -----------------
+// RMSEFileBench.c++
+// -----------------
+
+#include <cstdio>   // printf, remove
+#include <cstdlib>  // atol
+#include <fstream>  // ifstream, ofstream
+#include <string>   // string
+#include <thread>   // hardware_concurrency
+#include <vector>   // vector
+
+#include "Bench.h"
+#include "RMSEFile.h"
+
+/*
+RMSEFileBench [n [actual predicted]]
+with two file names, times those files, otherwise writes n doubles of each
+*/
+
+std::vector<double> load (const std::string& f) {
+    std::ifstream r(f, std::ios::binary | std::ios::ate);
+    std::vector<double> x(r.tellg() / sizeof(double));
+    r.seekg(0);
+    r.read(reinterpret_cast<char*>(x.data()), x.size() * sizeof(double));
+    return x;}
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const long n = (argc > 1) ? atol(argv[1]) : (1L << 24);
+    string a = "RMSEFileBench.a.bin";
+    string p = "RMSEFileBench.p.bin";
+    if (argc > 3) {
+        a = argv[2];
+        p = argv[3];}
+    else {
+        vector<double> x(n);
+        vector<double> y(n);
+        for (long i = 0; i != n; ++i) {
+            x[i] = i % 1000;
+            y[i] = (i + 1) % 1000;}
+        ofstream(a, ios::binary).write(reinterpret_cast<const char*>(x.data()), n * sizeof(double));
+        ofstream(p, ios::binary).write(reinterpret_cast<const char*>(y.data()), n * sizeof(double));}
+
+    const double m = Mapped_File(a).size() / 1e6 * 2;
+    printf("%.0f MB\n", m);
+    printf("%24s %10s %10s\n", "", "time", "MB/s");
+    const double t1 = bench([&] () {
+        const vector<double> x = load(a);
+        const vector<double> y = load(p);
+        do_not_optimize(rmse_while(x.data(), x.data() + x.size(), y.data(), 0.0));}, 3);
+    printf("%24s %9.3fs %10.0f\n", "load + rmse_while", t1, m / t1);
+    for (unsigned t = 1; t <= 2 * thread::hardware_concurrency(); t *= 2) {
+        const double t2 = bench([&] () {do_not_optimize(rmse_file<double>(a, p, t));}, 3);
+        printf("%15s %2u threads %9.3fs %10.0f\n", "rmse_file", t, t2, m / t2);}
+
+    if (argc <= 3) {
+        remove(a.c_str());
+        remove(p.c_str());}
+    return 0;}
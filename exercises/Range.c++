@@ -2,9 +2,12 @@
 // Range.c++
 // ---------
 
-#include <algorithm> // equal
-#include <cassert>   // assert
-#include <iostream>  // cout, endl
+#include <algorithm>   // equal, lower_bound
+#include <cassert>     // assert
+#include <iostream>    // cout, endl
+#include <iterator>    // distance, iterator_traits, random_access_iterator_tag
+#include <string>      // string
+#include <type_traits> // is_same
 
 #include "gtest/gtest.h"
 
@@ -62,6 +65,52 @@ TEST(RangeFixture, test_4) {
     Range<int> x(2, 5);
     ASSERT_TRUE(equal(begin(x), end(x), begin({2, 3, 4})));}
 
+TEST(RangeFixture, test_5) {
+    static_assert(is_same<iterator_traits<Range<int>::iterator>::iterator_category,              random_access_iterator_tag>::value, "");
+    static_assert(is_same<iterator_traits<Range<string::iterator>::iterator>::iterator_category, input_iterator_tag>::value,         "");
+    const Range<int> x(2, 1000000002);
+    ASSERT_EQ(1000000000, distance(begin(x), end(x)));
+    ASSERT_EQ(1000000000, end(x) - begin(x));}
+
+TEST(RangeFixture, test_6) {
+    const Range<int> x(2, 12);
+    Range<int>::iterator b = begin(x);
+    b += 5;
+    ASSERT_EQ(7, *b);
+    b -= 3;
+    ASSERT_EQ(4, *b);
+    ASSERT_EQ(9, *(b + 5));
+    ASSERT_EQ(9, *(5 + b));
+    ASSERT_EQ(1, *(b - 3));
+    ASSERT_EQ(4, *b--);
+    ASSERT_EQ(2, *--b);
+    ASSERT_EQ(11, b[9]);
+    ASSERT_TRUE(b < end(x));
+    ASSERT_TRUE(end(x) > b);
+    ASSERT_TRUE(b <= b);
+    ASSERT_FALSE(b >= end(x));}
+
+TEST(RangeFixture, test_7) {
+    const Range<long> x(0, 1L << 40);
+    ASSERT_EQ(123456789L, *lower_bound(begin(x), end(x), 123456789L));}
+
+TEST(RangeFixture, test_8) {
+    Range<int> x(2, 12);
+    ASSERT_EQ(10, x.size());
+    const Range<int> y = x.split();
+    ASSERT_EQ(5, x.size());
+    ASSERT_EQ(5, y.size());
+    ASSERT_EQ(2, *begin(x));
+    ASSERT_EQ(7, *begin(y));
+    ASSERT_EQ(end(x), begin(y));
+    ASSERT_EQ(12, *end(y));}
+
+TEST(RangeFixture, test_9) {
+    Range<int> x(2, 5);
+    const Range<int> y = x.split();
+    ASSERT_TRUE(equal(begin(x), end(x), begin({2})));
+    ASSERT_TRUE(equal(begin(y), end(y), begin({3, 4})));}
+
 /*
 % Range
 Running main() from gtest_main.cc
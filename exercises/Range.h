@@ -5,9 +5,10 @@
 #ifndef Range_h
 #define Range_h
 
-#include <cstddef>  // ptrdiff_t
-#include <iterator> // input_iterator_tag, iterator
-#include <utility>  // !=
+#include <cstddef>     // ptrdiff_t
+#include <iterator>    // input_iterator_tag, iterator, random_access_iterator_tag
+#include <type_traits> // conditional, is_arithmetic, is_integral
+#include <utility>     // !=
 
 /*
 namespace std {
@@ -37,6 +38,12 @@ inline bool operator != (const T& lhs, const T& rhs) {
 
 using std::rel_ops::operator!=;
 
+/*
+for an arithmetic T the iterator is random access,
+distance and jumps are O(1), so a range can be measured and split without walking it
+otherwise it is an input iterator and only ++ is meaningful
+*/
+
 template <typename T>
 class Range {
     private:
@@ -44,10 +51,12 @@ class Range {
         T _e;
 
     public:
-        class iterator : public std::iterator<std::input_iterator_tag, T> {
+        class iterator : public std::iterator<
+                typename std::conditional<std::is_arithmetic<T>::value, std::random_access_iterator_tag, std::input_iterator_tag>::type,
+                T> {
 /*
             public:
-                using iterator_category = input_iterator_tag;
+                using iterator_category = conditional<is_arithmetic<T>::value, random_access_iterator_tag, input_iterator_tag>::type;
                 using value_type        = T;
                 using difference_type   = ptrdiff_t;
                 using pointer           = T*;
@@ -56,15 +65,42 @@ class Range {
             friend bool operator == (const iterator& lhs, const iterator& rhs) {
                 return (lhs._v == rhs._v);}
 
+            friend bool operator < (const iterator& lhs, const iterator& rhs) {
+                return (lhs._v < rhs._v);}
+
+            friend bool operator > (const iterator& lhs, const iterator& rhs) {
+                return (rhs < lhs);}
+
+            friend bool operator <= (const iterator& lhs, const iterator& rhs) {
+                return !(rhs < lhs);}
+
+            friend bool operator >= (const iterator& lhs, const iterator& rhs) {
+                return !(lhs < rhs);}
+
+            friend iterator operator + (iterator lhs, std::ptrdiff_t rhs) {
+                return lhs += rhs;}
+
+            friend iterator operator + (std::ptrdiff_t lhs, iterator rhs) {
+                return rhs += lhs;}
+
+            friend iterator operator - (iterator lhs, std::ptrdiff_t rhs) {
+                return lhs -= rhs;}
+
+            friend std::ptrdiff_t operator - (const iterator& lhs, const iterator& rhs) {
+                return static_cast<std::ptrdiff_t>(lhs._v - rhs._v);}
+
             private:
                 T _v;
 
             public:
-                iterator (const T& v) :
+                // *(i + n) == *i + n, see Iota.h
+                typedef std::is_integral<T> is_counting;
+
+                constexpr iterator (const T& v) :
                         _v (v)
                     {}
 
-                const T& operator * () const {
+                constexpr const T& operator * () const {
                     return _v;}
 
                 iterator& operator ++ () {
@@ -74,7 +110,27 @@ class Range {
                 iterator operator ++ (int) {
                     iterator x = *this;
                     ++*this;
-                    return x;}};
+                    return x;}
+
+                iterator& operator -- () {
+                    --_v;
+                    return *this;}
+
+                iterator operator -- (int) {
+                    iterator x = *this;
+                    --*this;
+                    return x;}
+
+                iterator& operator += (std::ptrdiff_t n) {
+                    _v += n;
+                    return *this;}
+
+                iterator& operator -= (std::ptrdiff_t n) {
+                    _v -= n;
+                    return *this;}
+
+                T operator [] (std::ptrdiff_t n) const {
+                    return _v + n;}};
 
         Range (const T& b, const T& e) :
                 _b (b),
@@ -85,6 +141,29 @@ class Range {
             return iterator(_b);}
 
         iterator end () const {
-            return iterator(_e);}};
+            return iterator(_e);}
+
+        // T arithmetic
+
+        std::ptrdiff_t size () const {
+            return end() - begin();}
+
+        /**
+         * keep the lower half, return the upper half
+         */
+        Range split () {
+            const T m = _b + (_e - _b) / 2;
+            const Range x(m, _e);
+            _e = m;
+            return x;}
+
+        /**
+         * f(i) for each i, in order
+         */
+        template <typename F>
+        F for_each (F f) const {
+            for (iterator b = begin(), e = end(); b != e; ++b)
+                f(*b);
+            return f;}};
 
 #endif // Range_h
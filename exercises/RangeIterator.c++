@@ -2,7 +2,10 @@
 // RangeIterator.c++
 // -----------------
 
-#include <algorithm> // equal
+#include <algorithm>   // equal, lower_bound
+#include <iterator>    // distance, iterator_traits, random_access_iterator_tag
+#include <string>      // string
+#include <type_traits> // is_same
 
 #include "gtest/gtest.h"
 
@@ -39,6 +42,44 @@ TEST(RangeIteratorFixture, test_3) {
 TEST(RangeIteratorFixture, test_4) {
     ASSERT_TRUE(equal(Range_Iterator<int>(2), Range_Iterator<int>(5), begin({2, 3, 4})));}
 
+TEST(RangeIteratorFixture, test_5) {
+    static_assert(is_same<iterator_traits<Range_Iterator<int>>::iterator_category,         random_access_iterator_tag>::value, "");
+    static_assert(is_same<iterator_traits<Range_Iterator<double>>::iterator_category,      random_access_iterator_tag>::value, "");
+    static_assert(is_same<iterator_traits<Range_Iterator<string::iterator>>::iterator_category, input_iterator_tag>::value,  "");
+    const Range_Iterator<int> b = 2;
+    const Range_Iterator<int> e = 1000000002;
+    ASSERT_EQ(1000000000, distance(b, e));
+    ASSERT_EQ(1000000000, e - b);
+    ASSERT_EQ(-1000000000, b - e);}
+
+TEST(RangeIteratorFixture, test_6) {
+    Range_Iterator<int> b = 2;
+    b += 5;
+    ASSERT_EQ(7, *b);
+    b -= 3;
+    ASSERT_EQ(4, *b);
+    ASSERT_EQ(9, *(b + 5));
+    ASSERT_EQ(9, *(5 + b));
+    ASSERT_EQ(1, *(b - 3));
+    ASSERT_EQ(4, *b--);
+    ASSERT_EQ(2, *--b);
+    ASSERT_EQ(12, b[10]);}
+
+TEST(RangeIteratorFixture, test_7) {
+    const Range_Iterator<int> b = 2;
+    const Range_Iterator<int> e = 5;
+    ASSERT_TRUE (b <  e);
+    ASSERT_FALSE(e <  b);
+    ASSERT_TRUE (e >  b);
+    ASSERT_TRUE (b <= b);
+    ASSERT_TRUE (e >= b);
+    ASSERT_FALSE(b >= e);}
+
+TEST(RangeIteratorFixture, test_8) {
+    const Range_Iterator<long> b = 0;
+    const Range_Iterator<long> e = 1L << 40;
+    ASSERT_EQ(123456789L, *lower_bound(b, e, 123456789L));}
+
 /*
 % RangeIterator
 Running main() from gtest_main.cc
@@ -5,9 +5,10 @@
 #ifndef RangeIterator_h
 #define RangeIterator_h
 
-#include <cstddef>  // ptrdiff_t
-#include <iterator> // input_iterator_tag, iterator
-#include <utility>  // !=
+#include <cstddef>     // ptrdiff_t
+#include <iterator>    // input_iterator_tag, iterator, random_access_iterator_tag
+#include <type_traits> // conditional, is_arithmetic, is_integral
+#include <utility>     // !=
 
 /*
 namespace std {
@@ -37,11 +38,19 @@ inline bool operator != (const T& lhs, const T& rhs) {
 
 using std::rel_ops::operator!=;
 
+/*
+for an arithmetic T the iterator is random access,
+distance and jumps are O(1), so a range can be measured and split without walking it
+otherwise it is an input iterator and only ++ is meaningful
+*/
+
 template <typename T>
-class Range_Iterator : public std::iterator<std::input_iterator_tag, T> {
+class Range_Iterator : public std::iterator<
+        typename std::conditional<std::is_arithmetic<T>::value, std::random_access_iterator_tag, std::input_iterator_tag>::type,
+        T> {
 /*
     public:
-        using iterator_category = input_iterator_tag;
+        using iterator_category = conditional<is_arithmetic<T>::value, random_access_iterator_tag, input_iterator_tag>::type;
         using value_type        = T;
         using difference_type   = ptrdiff_t;
         using pointer           = T*;
@@ -50,10 +59,37 @@ class Range_Iterator : public std::iterator<std::input_iterator_tag, T> {
     friend bool operator == (const Range_Iterator& lhs, const Range_Iterator& rhs) {
             return (lhs._v == rhs._v);}
 
+    friend bool operator < (const Range_Iterator& lhs, const Range_Iterator& rhs) {
+            return (lhs._v < rhs._v);}
+
+    friend bool operator > (const Range_Iterator& lhs, const Range_Iterator& rhs) {
+            return (rhs < lhs);}
+
+    friend bool operator <= (const Range_Iterator& lhs, const Range_Iterator& rhs) {
+            return !(rhs < lhs);}
+
+    friend bool operator >= (const Range_Iterator& lhs, const Range_Iterator& rhs) {
+            return !(lhs < rhs);}
+
+    friend Range_Iterator operator + (Range_Iterator lhs, std::ptrdiff_t rhs) {
+            return lhs += rhs;}
+
+    friend Range_Iterator operator + (std::ptrdiff_t lhs, Range_Iterator rhs) {
+            return rhs += lhs;}
+
+    friend Range_Iterator operator - (Range_Iterator lhs, std::ptrdiff_t rhs) {
+            return lhs -= rhs;}
+
+    friend std::ptrdiff_t operator - (const Range_Iterator& lhs, const Range_Iterator& rhs) {
+            return static_cast<std::ptrdiff_t>(lhs._v - rhs._v);}
+
     private:
         T _v;
 
     public:
+        // *(i + n) == *i + n, see Iota.h
+        typedef std::is_integral<T> is_counting;
+
         Range_Iterator (const T& v) :
                 _v (v)
             {}
@@ -68,6 +104,26 @@ class Range_Iterator : public std::iterator<std::input_iterator_tag, T> {
         Range_Iterator operator ++ (int) {
             Range_Iterator x = *this;
             ++*this;
-            return x;}};
+            return x;}
+
+        Range_Iterator& operator -- () {
+            --_v;
+            return *this;}
+
+        Range_Iterator operator -- (int) {
+            Range_Iterator x = *this;
+            --*this;
+            return x;}
+
+        Range_Iterator& operator += (std::ptrdiff_t n) {
+            _v += n;
+            return *this;}
+
+        Range_Iterator& operator -= (std::ptrdiff_t n) {
+            _v -= n;
+            return *this;}
+
+        T operator [] (std::ptrdiff_t n) const {
+            return _v + n;}};
 
 #endif // RangeIterator_h
@@ -0,0 +1,59 @@
+// ---------------------
+// SegmentedIterator.c++
+// ---------------------
+
+// http://lafstern.org/matt/segmented.pdf
+
+#include <deque>    // deque
+#include <list>     // list
+#include <vector>   // vector
+
+#include "gtest/gtest.h"
+
+#include "SegmentedIterator.h"
+
+using namespace std;
+
+TEST(SegmentedIteratorFixture, test_1) {
+    ASSERT_FALSE(is_segmented_iterator<int*>::value);
+    ASSERT_FALSE(is_segmented_iterator<vector<int>::iterator>::value);
+    ASSERT_FALSE(is_segmented_iterator<list<int>::iterator>::value);}
+
+#ifdef __GLIBCXX__
+TEST(SegmentedIteratorFixture, test_2) {
+    ASSERT_TRUE(is_segmented_iterator<deque<int>::iterator>::value);
+    ASSERT_TRUE(is_segmented_iterator<deque<int>::const_iterator>::value);}
+
+TEST(SegmentedIteratorFixture, test_3) {
+    typedef segmented_iterator_traits<deque<int>::const_iterator> traits;
+    deque<int> x;
+    for (int i = 0; i != 1000; ++i)
+        x.push_back(i);
+    const deque<int>& y = x;
+    traits::segment_iterator sb = traits::segment(begin(y));
+    traits::segment_iterator se = traits::segment(end(y));
+    traits::local_iterator   l  = traits::local(begin(y));
+    int v = 0;
+    while (true) {
+        const traits::local_iterator e = (sb == se) ? traits::local(end(y)) : traits::end(sb);
+        for (; l != e; ++l, ++v)
+            ASSERT_EQ(v, *l);
+        if (sb == se)
+            break;
+        ++sb;
+        l = traits::begin(sb);}
+    ASSERT_EQ(1000, v);}
+
+TEST(SegmentedIteratorFixture, test_4) {
+    typedef segmented_iterator_traits<deque<int>::iterator> traits;
+    deque<int> x(1000);
+    deque<int>::iterator p = begin(x) + 500;
+    ASSERT_EQ(&*p, traits::local(p));
+    ASSERT_LE(traits::begin(traits::segment(p)), traits::local(p));
+    ASSERT_LT(traits::local(p), traits::end(traits::segment(p)));}
+#endif
+
+TEST(SegmentedIteratorFixture, test_5) {
+    ASSERT_TRUE (is_random_access_iterator<int*>::value);
+    ASSERT_TRUE (is_random_access_iterator<deque<int>::iterator>::value);
+    ASSERT_FALSE(is_random_access_iterator<list<int>::iterator>::value);}
@@ -0,0 +1,71 @@
+// -------------------
+// SegmentedIterator.h
+// -------------------
+
+#ifndef SegmentedIterator_h
+#define SegmentedIterator_h
+
+#include <deque>       // _Deque_iterator
+#include <iterator>    // iterator_traits, random_access_iterator_tag
+#include <type_traits> // integral_constant, is_same
+
+/*
+a segmented iterator walks a sequence of contiguous segments, like a deque
+the traits expose the segments so that an algorithm can run a contiguous
+kernel inside each segment and only pay the boundary check once per segment
+
+segment(i)  : the segment that i is in
+local(i)    : the pointer to i inside its segment
+begin(s)    : the pointer to the first element of segment s
+end(s)      : the pointer one past the last element of segment s
+*/
+
+// -------------------------
+// segmented_iterator_traits
+// -------------------------
+
+template <typename I>
+struct segmented_iterator_traits {
+    static const bool is_segmented = false;};
+
+#ifdef __GLIBCXX__
+template <typename T, typename R, typename P>
+struct segmented_iterator_traits<std::_Deque_iterator<T, R, P>> {
+    typedef std::_Deque_iterator<T, R, P>            iterator;
+    typedef typename iterator::_Map_pointer          segment_iterator;
+    typedef P                                        local_iterator;
+
+    static const bool is_segmented = true;
+
+    static segment_iterator segment (const iterator& i) {
+        return i._M_node;}
+
+    static local_iterator local (const iterator& i) {
+        return i._M_cur;}
+
+    static local_iterator begin (segment_iterator s) {
+        return *s;}
+
+    static local_iterator end (segment_iterator s) {
+        return *s + iterator::_S_buffer_size();}};
+#endif
+
+// ---------------------
+// is_segmented_iterator
+// ---------------------
+
+template <typename I>
+struct is_segmented_iterator :
+        std::integral_constant<bool, segmented_iterator_traits<I>::is_segmented>
+    {};
+
+// -------------------------
+// is_random_access_iterator
+// -------------------------
+
+template <typename I>
+struct is_random_access_iterator :
+        std::is_same<typename std::iterator_traits<I>::iterator_category, std::random_access_iterator_tag>
+    {};
+
+#endif // SegmentedIterator_h
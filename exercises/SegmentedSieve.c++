@@ -0,0 +1,89 @@
+// ------------------
+// SegmentedSieve.c++
+// ------------------
+
+// https://en.wikipedia.org/wiki/Sieve_of_Eratosthenes#Segmented_sieve
+// https://en.wikipedia.org/wiki/Wheel_factorization
+
+#include <cstdint> // uint64_t
+#include <mutex>   // lock_guard, mutex
+#include <vector>  // vector
+
+#include "gtest/gtest.h"
+
+#include "IsPrime3.h"
+#include "SegmentedSieve.h"
+
+using namespace std;
+
+TEST(SegmentedSieveFixture, test_1) {
+    ASSERT_EQ(       0u, count_primes(0,         2, 1));
+    ASSERT_EQ(       1u, count_primes(0,         3, 1));
+    ASSERT_EQ(       3u, count_primes(0,         7, 1));
+    ASSERT_EQ(       4u, count_primes(0,         8, 1));
+    ASSERT_EQ(      10u, count_primes(0,        30, 1));
+    ASSERT_EQ(      25u, count_primes(0,       100, 1));
+    ASSERT_EQ(       2u, count_primes(3,         7, 1));
+    ASSERT_EQ(       0u, count_primes(24,       29, 1));
+    ASSERT_EQ(       1u, count_primes(29,       30, 1));
+    ASSERT_EQ(       0u, count_primes(100,     100, 1));}
+
+TEST(SegmentedSieveFixture, test_2) {
+    ASSERT_EQ(  664579u, count_primes(0,  10000000, 1));
+    ASSERT_EQ(  664579u, count_primes(0,  10000000, 3));
+    ASSERT_EQ(  664579u, count_primes(0,  10000000, 8));
+    ASSERT_EQ( 5761455u, count_primes(0, 100000000));}
+
+TEST(SegmentedSieveFixture, test_3) {
+    const uint64_t b = 1000000000000ULL;
+    const uint64_t e = b + 100000;
+    uint64_t c = 0;
+    for (uint64_t n = b; n != e; ++n)
+        c += is_prime(n);
+    ASSERT_EQ(c, count_primes(b, e, 1));
+    ASSERT_EQ(c, count_primes(b, e, 4));}
+
+TEST(SegmentedSieveFixture, test_4) {
+    vector<uint64_t> x;
+    for_each_prime(0, 3000000, [&x] (uint64_t p) {x.push_back(p);});
+    ASSERT_EQ(216816u, x.size());
+    uint64_t n = 0;
+    for (uint64_t p : x) {
+        for (; n != p; ++n)
+            ASSERT_FALSE(is_prime(n));
+        ASSERT_TRUE(is_prime(p));
+        ++n;}}
+
+TEST(SegmentedSieveFixture, test_5) {
+    const uint64_t b = 123456789;
+    const uint64_t e = b + 5000000;
+    mutex         m;
+    uint64_t      c = 0;
+    uint64_t      s = 0;
+    for_each_prime(b, e, [&] (uint64_t p) {
+        ASSERT_TRUE(is_prime(p));
+        lock_guard<mutex> g(m);
+        ++c;
+        s += p;}, 4);
+    uint64_t d = 0;
+    uint64_t t = 0;
+    for_each_prime(b, e, [&] (uint64_t p) {++d; t += p;});
+    ASSERT_EQ(count_primes(b, e, 2), c);
+    ASSERT_EQ(d, c);
+    ASSERT_EQ(t, s);}
+
+TEST(SegmentedSieveFixture, test_6) {
+    const uint32_t         p = 4294967291u;                    // the largest prime below 2^32
+    const uint64_t         b = uint64_t(p) * p;                // near the top of the 64-bit range
+    const uint64_t         e = b + 30;
+    const vector<uint32_t> q(1, p);                            // the sieve keeps a reference
+    Segmented_Sieve        x(q, b, e);
+    vector<uint64_t>       y;
+    auto                   f = [&y] (uint64_t n) {y.push_back(n);};
+    while (x.next())
+        x.each(f);
+    vector<uint64_t> z;
+    for (uint64_t n = b; n != e; ++n)
+        if ((n % 2 != 0) && (n % 3 != 0) && (n % 5 != 0) && (n % p != 0))
+            z.push_back(n);
+    ASSERT_EQ(z, y);}
@@ -0,0 +1,252 @@
+// ----------------
+// SegmentedSieve.h
+// ----------------
+
+#ifndef SegmentedSieve_h
+#define SegmentedSieve_h
+
+#include <algorithm> // max, min
+#include <cmath>     // sqrt
+#include <cstddef>   // size_t
+#include <cstdint>   // uint32_t, uint64_t
+#include <initializer_list> // initializer_list
+#include <thread>    // thread
+#include <vector>    // vector
+
+#include "PrimeSieve.h"
+
+/*
+a segmented sieve of Eratosthenes over [lo, hi) with a 2 * 3 * 5 wheel
+each byte covers 30 numbers, one bit for each of the 8 residues mod 30
+that are coprime to 30, so multiples of 2, 3 and 5 are never stored
+
+a segment is 32 KB of bytes, about 10^6 numbers, and fits in L1
+each prime p > 5 crosses off its multiples in 8 residue classes; within
+a class the multiples are 30p apart, so p bytes apart, all on one bit
+*/
+
+// --------
+// Wheel_30
+// --------
+
+template <typename V = void>
+struct Wheel_30 {
+    static const std::uint32_t residue[8];              // residue[j], the number of bit j
+    static const signed char   index[30];};             // index[r], the bit of residue r, or -1
+
+template <typename V>
+const std::uint32_t Wheel_30<V>::residue[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+
+template <typename V>
+const signed char Wheel_30<V>::index[30] = {
+    -1,  0, -1, -1, -1, -1, -1,  1, -1, -1, -1,  2, -1,  3, -1,
+    -1, -1,  4, -1,  5, -1, -1, -1,  6, -1, -1, -1, -1, -1,  7};
+
+// ---------------
+// Segmented_Sieve
+// ---------------
+
+/*
+one thread's walk over [lo, hi), one segment at a time
+the base primes are shared, the next multiple of each prime in each
+residue class is kept per sieve and carried from segment to segment
+*/
+
+class Segmented_Sieve {
+    public:
+        static const std::size_t B = 32 * 1024;        // bytes per segment
+
+    private:
+        const std::vector<std::uint32_t>& _p;           // base primes, 7 <= p <= sqrt(hi)
+        std::vector<std::uint64_t>        _o;           // next byte of p * q, 8 per prime, relative to _k
+        std::vector<std::uint64_t>        _s;           // the segment, as words for popcount
+        std::uint64_t                     _lo;
+        std::uint64_t                     _hi;
+        std::uint64_t                     _k;           // first byte of the segment, the number 30 * _k
+        std::uint64_t                     _e;           // one past the last byte of [lo, hi)
+        std::size_t                       _n;           // bytes in the segment
+
+        unsigned char* bytes () {
+            return reinterpret_cast<unsigned char*>(_s.data());}
+
+        // clear the bits of the numbers outside [lo, hi)
+        void mask () {
+            typedef Wheel_30<> W;
+            unsigned char* const s = bytes();
+            for (int j = 0; j != 8; ++j) {
+                if ((30 * _k + W::residue[j]) < _lo)
+                    s[0] &= ~(1u << j);
+                if ((30 * (_k + _n - 1) + W::residue[j]) >= _hi)
+                    s[_n - 1] &= ~(1u << j);}
+            if (_k == 0)
+                s[0] &= ~1u;}                               // 1 is not prime
+
+    public:
+        Segmented_Sieve (const std::vector<std::uint32_t>& p, std::uint64_t lo, std::uint64_t hi) :
+                _p  (p),
+                _o  (8 * p.size()),
+                _s  (B / 8),
+                _lo (lo),
+                _hi (hi),
+                _k  (lo / 30),
+                _e  ((hi + 29) / 30),
+                _n  (0) {
+            typedef Wheel_30<> W;
+            for (std::size_t i = 0; i != _p.size(); ++i) {
+                const std::uint64_t p = _p[i];
+                const std::uint64_t q = std::max(p, (30 * _k + p - 1) / p);
+                for (int j = 0; j != 8; ++j) {
+                    const std::uint64_t r = q + (W::residue[j] + 30 - (q % 30)) % 30;
+                    _o[8 * i + j] = (p * r) / 30 - _k;}}}
+
+        Segmented_Sieve             (const Segmented_Sieve&) = delete;
+        Segmented_Sieve& operator = (const Segmented_Sieve&) = delete;
+
+        // ----
+        // next
+        // ----
+
+        /**
+         * sieve the next segment, false if there is none
+         */
+        bool next () {
+            typedef Wheel_30<> W;
+            if (_n != 0) {
+                _k += _n;
+                for (std::size_t i = 0; i != _o.size(); ++i)
+                    _o[i] -= _n;}
+            if (_k >= _e)
+                return false;
+            _n = std::min(static_cast<std::uint64_t>(B), _e - _k);
+            std::fill(_s.begin(), _s.end(), ~std::uint64_t(0));
+            unsigned char* const s = bytes();
+            for (std::size_t i = 0; i != _p.size(); ++i) {
+                const std::uint32_t p = _p[i];
+                for (int j = 0; j != 8; ++j) {
+                    const unsigned char m = ~(1u << W::index[(std::uint64_t(p) * W::residue[j]) % 30]);
+                    std::uint64_t o = _o[8 * i + j];
+                    for (; o < _n; o += p)
+                        s[o] &= m;
+                    _o[8 * i + j] = o;}}
+            std::fill(s + _n, s + B, 0);
+            mask();
+            return true;}
+
+        // -----
+        // count
+        // -----
+
+        /**
+         * the number of primes in the segment
+         */
+        std::uint64_t count () const {
+            std::uint64_t c = 0;
+            for (std::size_t i = 0; i != _s.size(); ++i)
+                c += __builtin_popcountll(_s[i]);
+            return c;}
+
+        // ----
+        // each
+        // ----
+
+        /**
+         * call f on each prime in the segment, in increasing order
+         */
+        template <typename F>
+        void each (F& f) const {
+            typedef Wheel_30<> W;
+            const unsigned char* const s = reinterpret_cast<const unsigned char*>(_s.data());
+            for (std::size_t i = 0; i != _n; ++i)
+                for (unsigned b = s[i]; b != 0; b &= (b - 1))
+                    f(30 * (_k + i) + W::residue[__builtin_ctz(b)]);}};
+
+// -----------
+// base_primes
+// -----------
+
+/**
+ * the primes p, 7 <= p <= sqrt(hi)
+ */
+inline std::vector<std::uint32_t> base_primes (std::uint64_t hi) {
+    std::uint64_t r = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(hi)));
+    while ((r * r) > hi)
+        --r;
+    while (((r + 1) * (r + 1)) <= hi)
+        ++r;
+    const Prime_Sieve s(r + 1);
+    std::vector<std::uint32_t> p;
+    for (std::uint64_t n = 7; n <= r; n += 2)
+        if (s.is_prime(n))
+            p.push_back(n);
+    return p;}
+
+// ----------------
+// for_each_segment
+// ----------------
+
+/**
+ * split [lo, hi) into t chunks of whole segments, one thread each,
+ * and call g(sieve) after each segment is sieved
+ * 2, 3 and 5 are not in the wheel, the caller handles them
+ */
+template <typename G>
+void for_each_segment (std::uint64_t lo, std::uint64_t hi, unsigned t, G g) {
+    if (lo >= hi)
+        return;
+    const std::vector<std::uint32_t> p = base_primes(hi);
+    const std::uint64_t k = lo / 30;
+    const std::uint64_t e = (hi + 29) / 30;
+    const std::uint64_t s = Segmented_Sieve::B;
+    t = std::max(1u, std::min<unsigned>(t, (e - k + s - 1) / s));
+    const std::uint64_t c = ((e - k + t - 1) / t + s - 1) / s * s;          // bytes per thread
+    std::vector<std::thread> w;
+    for (unsigned i = 0; i != t; ++i) {
+        const std::uint64_t b = std::max(lo, 30 * (k + i * c));
+        const std::uint64_t d = std::min(hi, 30 * (k + (i + 1) * c));
+        if (b >= d)
+            break;
+        w.push_back(std::thread([&p, &g, b, d, i] () {
+            Segmented_Sieve x(p, b, d);
+            while (x.next())
+                g(i, x);}));}
+    for (std::size_t i = 0; i != w.size(); ++i)
+        w[i].join();}
+
+// ------------
+// count_primes
+// ------------
+
+/**
+ * the number of primes in [lo, hi)
+ */
+inline std::uint64_t count_primes (std::uint64_t lo, std::uint64_t hi, unsigned t = std::thread::hardware_concurrency()) {
+    std::uint64_t c = 0;
+    for (std::uint64_t n : {2, 3, 5})
+        if ((n >= lo) && (n < hi))
+            ++c;
+    std::vector<std::uint64_t> v(std::max(1u, t), 0);
+    for_each_segment(lo, hi, t, [&v] (unsigned i, const Segmented_Sieve& x) {
+        v[i] += x.count();});
+    for (std::size_t i = 0; i != v.size(); ++i)
+        c += v[i];
+    return c;}
+
+// --------------
+// for_each_prime
+// --------------
+
+/**
+ * call f(p) on each prime in [lo, hi)
+ * with one thread, in increasing order
+ * with t threads, f is called concurrently from t threads, each in
+ * increasing order over its own chunk of the range
+ */
+template <typename F>
+void for_each_prime (std::uint64_t lo, std::uint64_t hi, F f, unsigned t = 1) {
+    for (std::uint64_t n : {2, 3, 5})
+        if ((n >= lo) && (n < hi))
+            f(n);
+    for_each_segment(lo, hi, t, [&f] (unsigned, const Segmented_Sieve& x) {
+        x.each(f);});}
+
+#endif // SegmentedSieve_h
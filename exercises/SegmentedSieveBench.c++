@@ -0,0 +1,38 @@
+// -----------------------
+// SegmentedSieveBench.c++
+// -----------------------
+
+#include <cstdint> // uint64_t
+#include <cstdio>  // printf
+#include <cstdlib> // atoll
+#include <thread>  // hardware_concurrency
+
+#include "Bench.h"
+#include "PrimeSieve.h"
+#include "SegmentedSieve.h"
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const uint64_t m = (argc > 1) ? atoll(argv[1]) : 1000000000;
+    const unsigned h = thread::hardware_concurrency();
+
+    uint64_t c = 0;
+    const double t0 = bench([&] () {Prime_Sieve s(m); c = s.limit(); do_not_optimize(c);}, 1);
+    printf("pi(%llu), Prime_Sieve %.3fs\n\n", static_cast<unsigned long long>(m), t0);
+
+    printf("%8s %12s %10s %10s\n", "threads", "count", "time", "speedup");
+    double t1 = 0;
+    for (unsigned t = 1; t <= h; t *= 2) {
+        const double t2 = bench([&] () {c = count_primes(0, m, t);}, 3);
+        if (t == 1)
+            t1 = t2;
+        printf("%8u %12llu %9.3fs %9.2fx\n", t, static_cast<unsigned long long>(c), t2, t1 / t2);}
+
+    const uint64_t b = 1000000000000ULL;
+    uint64_t s = 0;
+    const double t3 = bench([&] () {s = 0; for_each_prime(b, b + m / 10, [&s] (uint64_t p) {s += p;}); do_not_optimize(s);}, 3);
+    const double t4 = bench([&] () {c = count_primes(b, b + m / 10, h);}, 3);
+    printf("\n[10^12, 10^12 + %llu)\n", static_cast<unsigned long long>(m / 10));
+    printf("%20s %9.3fs\n", "enumerate, 1 thread", t3);
+    printf("%20s %9.3fs\n", "count, all threads",  t4);
+    return 0;}
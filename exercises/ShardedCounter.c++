@@ -0,0 +1,56 @@
+// ------------------
+// ShardedCounter.c++
+// ------------------
+
+// https://en.wikipedia.org/wiki/False_sharing
+
+#include <thread> // thread
+#include <vector> // vector
+
+#include "gtest/gtest.h"
+
+#include "ShardedCounter.h"
+
+using namespace std;
+
+TEST(ShardedCounterFixture, test_1) {
+    Sharded_Counter<> x;
+    ASSERT_EQ(0, x.load());
+    x.incr();
+    x.incr();
+    x.add(5);
+    ASSERT_EQ(7, x.load());}
+
+TEST(ShardedCounterFixture, test_2) {
+    ASSERT_EQ(shard_index(), shard_index());
+    unsigned i = shard_index();
+    unsigned j = i;
+    thread([&j] () {j = shard_index();}).join();
+    ASSERT_NE(i, j);}
+
+TEST(ShardedCounterFixture, test_3) {
+    Sharded_Counter<long> x;
+    vector<thread> v;
+    for (int k = 0; k != 8; ++k)
+        v.push_back(thread([&x] () {
+            for (int n = 0; n != 100000; ++n)
+                x.incr();}));
+    for (thread& t : v)
+        t.join();
+    ASSERT_EQ(800000, x.load());}
+
+TEST(ShardedCounterFixture, test_4) {
+    // more threads than shards
+    Sharded_Counter<int, 4> x;
+    vector<thread> v;
+    for (int k = 0; k != 16; ++k)
+        v.push_back(thread([&x, k] () {
+            for (int n = 0; n != 1000; ++n)
+                x.add(k);}));
+    for (thread& t : v)
+        t.join();
+    ASSERT_EQ(120000, x.load());}
+
+TEST(ShardedCounterFixture, test_5) {
+    ASSERT_EQ(64u, alignof(Sharded_Counter<>));
+    ASSERT_EQ(64u * 64u, sizeof(Sharded_Counter<>));}
@@ -0,0 +1,72 @@
+// ----------------
+// ShardedCounter.h
+// ----------------
+
+#ifndef ShardedCounter_h
+#define ShardedCounter_h
+
+#include <atomic>  // atomic, memory_order_relaxed
+#include <cstddef> // size_t
+
+#include "Incr.h"
+
+/*
+a counter incremented from many threads and read rarely
+one atomic bounces its cache line between every core that touches it
+instead, each thread increments its own shard, one cache line each,
+with a relaxed read-modify-write, and a read sums the shards
+
+a read is not a snapshot, increments that race with it may or may not
+be counted, and the sum is exact once the writers are done
+where every increment needs its own value, like a ticket or an id,
+use pre_incr or post_incr on one std::atomic instead
+*/
+
+// -----------
+// shard_index
+// -----------
+
+/**
+ * a small number for the calling thread, handed out round robin
+ */
+inline unsigned shard_index () {
+    static std::atomic<unsigned> n(0);
+    static thread_local const unsigned i = post_incr(n, std::memory_order_relaxed);
+    return i;}
+
+// ---------------
+// Sharded_Counter
+// ---------------
+
+template <typename T = long, std::size_t N = 64>
+class Sharded_Counter {
+    private:
+        struct alignas(64) Shard {
+            std::atomic<T> v;};
+
+        Shard _s[N];
+
+    public:
+        Sharded_Counter () {
+            for (std::size_t i = 0; i != N; ++i)
+                _s[i].v.store(0, std::memory_order_relaxed);}
+
+        Sharded_Counter             (const Sharded_Counter&) = delete;
+        Sharded_Counter& operator = (const Sharded_Counter&) = delete;
+
+        void add (T n) {
+            _s[shard_index() % N].v.fetch_add(n, std::memory_order_relaxed);}
+
+        void incr () {
+            add(1);}
+
+        /**
+         * the sum of the shards
+         */
+        T load () const {
+            T s = 0;
+            for (std::size_t i = 0; i != N; ++i)
+                s += _s[i].v.load(std::memory_order_relaxed);
+            return s;}};
+
+#endif // ShardedCounter_h
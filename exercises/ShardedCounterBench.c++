@@ -0,0 +1,46 @@
+// -----------------------
+// ShardedCounterBench.c++
+// -----------------------
+
+#include <atomic>  // atomic
+#include <cstdio>  // printf
+#include <cstdlib> // atoi
+#include <thread>  // thread
+#include <vector>  // vector
+
+#include "Bench.h"
+#include "Incr.h"
+#include "ShardedCounter.h"
+
+// t threads, each calling f() n times, started together
+template <typename F>
+double contend (unsigned t, int n, F f) {
+    return bench([&] () {
+        std::atomic<bool>        go(false);
+        std::vector<std::thread> v;
+        for (unsigned i = 0; i != t; ++i)
+            v.push_back(std::thread([&] () {
+                while (!go.load())
+                    {}
+                for (int j = 0; j != n; ++j)
+                    f();}));
+        go.store(true);
+        for (std::thread& w : v)
+            w.join();}, 3);}
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    printf("%d increments per thread, %u hardware threads\n", n, thread::hardware_concurrency());
+    printf("%8s %14s %14s %14s\n", "threads", "atomic", "atomic relaxed", "sharded");
+    for (unsigned t = 1; t <= 64; t *= 2) {
+        atomic<long>      a(0);
+        atomic<long>      b(0);
+        Sharded_Counter<> c;
+        const double t1 = contend(t, n, [&a] () {post_incr(a);});
+        const double t2 = contend(t, n, [&b] () {post_incr(b, memory_order_relaxed);});
+        const double t3 = contend(t, n, [&c] () {c.incr();});
+        do_not_optimize(c.load());
+        const double m  = static_cast<double>(t) * n;
+        printf("%8u %12.2fns %12.2fns %12.2fns\n", t, t1 * 1e9 / m, t2 * 1e9 / m, t3 * 1e9 / m);}
+    return 0;}
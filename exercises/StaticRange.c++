@@ -0,0 +1,52 @@
+// ---------------
+// StaticRange.c++
+// ---------------
+
+// http://en.cppreference.com/w/cpp/utility/integer_sequence
+
+#include <algorithm> // equal
+#include <vector>    // vector
+
+#include "gtest/gtest.h"
+
+#include "Range.h"
+#include "StaticRange.h"
+
+using namespace std;
+
+// generic over Range<int> and Static_Range<B, E>
+template <typename R>
+int sum (const R& x) {
+    int s = 0;
+    x.for_each([&s] (int i) {s += i;});
+    return s;}
+
+TEST(StaticRangeFixture, test_1) {
+    constexpr Static_Range<2, 5> x;
+    static_assert(x.size() == 3, "");
+    static_assert(*x.begin() == 2, "");
+    static_assert(*x.end()   == 5, "");
+    ASSERT_TRUE(equal(begin(x), end(x), begin({2, 3, 4})));}
+
+TEST(StaticRangeFixture, test_2) {
+    const Static_Range<0, 0> x;
+    ASSERT_EQ(0, x.size());
+    ASSERT_EQ(begin(x), end(x));
+    ASSERT_EQ(0, sum(x));}
+
+TEST(StaticRangeFixture, test_3) {
+    vector<int> v;
+    Static_Range<-3, 13>().for_each([&v] (int i) {v.push_back(i);});
+    ASSERT_EQ(16u, v.size());
+    for (int i = 0; i != 16; ++i)
+        ASSERT_EQ(i - 3, v[i]);}
+
+TEST(StaticRangeFixture, test_4) {
+    ASSERT_EQ(sum(Range<int>(0, 16)), sum(Static_Range<0, 16>()));
+    ASSERT_EQ(sum(Range<int>(5, 9)),  sum(Static_Range<5, 9>()));}
+
+TEST(StaticRangeFixture, test_5) {
+    int s = 0;
+    for (int i : Static_Range<1, 5>())
+        s += i;
+    ASSERT_EQ(10, s);}
@@ -0,0 +1,55 @@
+// -------------
+// StaticRange.h
+// -------------
+
+#ifndef StaticRange_h
+#define StaticRange_h
+
+#include <cstddef> // ptrdiff_t
+
+#include "IndexList.h"
+#include "Range.h"
+
+/*
+a Range<int> whose bounds are template arguments
+it has the interface of Range, begin, end, size and for_each, so
+generic code takes either one, but its for_each expands f(B), f(B + 1),
+..., f(E - 1) at compile time, with no counter and no compare
+meant for small fixed extents, 4, 8 or 16, the code grows with E - B
+*/
+
+// ------------
+// Static_Range
+// ------------
+
+template <int B, int E>
+class Static_Range {
+    static_assert(B <= E, "B must not be greater than E");
+
+    private:
+        template <typename F, std::size_t... I>
+        static void unroll (F& f, index_list<I...>) {
+            const int a[] = {0, (f(B + static_cast<int>(I)), 0)...};       // in order, left to right
+            static_cast<void>(a);}
+
+    public:
+        typedef Range<int>::iterator iterator;
+
+        constexpr iterator begin () const {
+            return iterator(B);}
+
+        constexpr iterator end () const {
+            return iterator(E);}
+
+        constexpr std::ptrdiff_t size () const {
+            return E - B;}
+
+        /**
+         * f(i) for each i, in order, unrolled
+         */
+        template <typename F>
+        F for_each (F f) const {
+            unroll(f, typename make_index_list<E - B>::type());
+            return f;}};
+
+#endif // StaticRange_h
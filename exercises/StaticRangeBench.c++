@@ -0,0 +1,40 @@
+// --------------------
+// StaticRangeBench.c++
+// --------------------
+
+// to see the code, g++ -std=c++11 -O3 -S StaticRangeBench.c++,
+// and look for the loop over i in dot<Range<int>> and dot<Static_Range<0, K>>
+
+#include <cstdio>  // printf
+#include <vector>  // vector
+
+#include "Bench.h"
+#include "Range.h"
+#include "StaticRange.h"
+
+// K wide dot products of consecutive blocks of a with w
+template <typename R>
+__attribute__((noinline)) float dot (const R& x, const float* a, const float* w, int n, int k) {
+    float t = 0;
+    for (int j = 0; j != n; ++j, a += k) {
+        float s = 0;
+        x.for_each([&] (int i) {s += a[i] * w[i];});
+        t += s;}
+    return t;}
+
+template <int K>
+void run () {
+    using namespace std;
+    const int     n = (1 << 20) / K;
+    vector<float> a(n * K, 1.5f);
+    vector<float> w(K, 0.5f);
+    const double t1 = bench([&] () {do_not_optimize(dot(Range<int>(0, K),   a.data(), w.data(), n, K));});
+    const double t2 = bench([&] () {do_not_optimize(dot(Static_Range<0, K>(), a.data(), w.data(), n, K));});
+    printf("%4d %10.3fns %10.3fns\n", K, t1 * 1e9 / n, t2 * 1e9 / n);}
+
+int main () {
+    printf("%4s %12s %12s\n", "K", "Range", "Static_Range");
+    run<4>();
+    run<8>();
+    run<16>();
+    return 0;}
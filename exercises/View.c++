@@ -0,0 +1,62 @@
+// --------
+// View.c++
+// --------
+
+// http://en.cppreference.com/w/cpp/ranges
+
+#include <functional> // multiplies
+#include <list>       // list
+#include <vector>     // vector
+
+#include "gtest/gtest.h"
+
+#include "Range.h"
+#include "View.h"
+
+using namespace std;
+
+TEST(ViewFixture, test_1) {
+    const vector<int> x = {2, 3, 4};
+    ASSERT_EQ(9,  view(x).reduce(0));
+    ASSERT_EQ(24, view(begin(x), end(x)).reduce(1, multiplies<int>()));
+    ASSERT_EQ(0,  view(begin(x), begin(x)).reduce(0));}
+
+TEST(ViewFixture, test_2) {
+    const Range<int> x(0, 10);
+    ASSERT_EQ(285, view(x).transform([] (int i) {return i * i;}).reduce(0));
+    ASSERT_EQ(20,  view(x).filter([] (int i) {return (i % 2) == 0;}).reduce(0));}
+
+TEST(ViewFixture, test_3) {
+    const Range<int> x(0, 1000000000);
+    ASSERT_EQ(10, view(x).take(5).reduce(0));
+    ASSERT_EQ(0,  view(x).take(0).reduce(0));
+    ASSERT_EQ(45, view(Range<int>(0, 10)).take(20).reduce(0));}
+
+TEST(ViewFixture, test_4) {
+    const Range<int> x(0, 10);
+    ASSERT_EQ(0 + 3 + 6 + 9, view(x).stride(3).reduce(0));
+    ASSERT_EQ(45,            view(x).stride(1).reduce(0));
+    ASSERT_EQ(0,             view(x).stride(20).reduce(0));}
+
+TEST(ViewFixture, test_5) {
+    const list<double>   x = {2, 3, 4};
+    const vector<double> y = {4, 1, 6};
+    ASSERT_EQ(12, zip(begin(x), end(x), begin(y)).transform([] (double a, double p) {return (a - p) * (a - p);}).reduce(0.0));
+    ASSERT_EQ(2,  zip(begin(x), end(x), begin(y)).filter([] (double a, double p) {return a > p;}).transform([] (double a, double p) {return a - p;}).reduce(0.0));}
+
+TEST(ViewFixture, test_6) {
+    // the first 3 odd squares above 10
+    vector<int> y;
+    view(Range<int>(0, 1000000000))
+        .transform([] (int i) {return i * i;})
+        .filter([] (int i) {return (i > 10) && (i % 2);})
+        .take(3)
+        .for_each([&y] (int i) {y.push_back(i);});
+    ASSERT_EQ(vector<int>({25, 49, 81}), y);}
+
+TEST(ViewFixture, test_7) {
+    int c = 0;
+    view(Range<int>(0, 100)).stride(10).take(4).for_each([&c] (int) {++c;});
+    ASSERT_EQ(4, c);
+    const int s = view(Range<int>(0, 100)).take(10).stride(4).reduce(0);
+    ASSERT_EQ(0 + 4 + 8, s);}
@@ -0,0 +1,320 @@
+// ------
+// View.h
+// ------
+
+#ifndef View_h
+#define View_h
+
+#include <cstddef>    // ptrdiff_t
+#include <functional> // plus
+
+/*
+lazy views, composed by chaining, run by a terminal reduce or for_each
+
+    zip(b, e, c).transform(f).filter(p).take(n).reduce(v)
+
+a view stores its source and its function by value and allocates nothing
+it pushes its elements into a sink, g(x...), which returns false to stop
+each stage wraps the sink of the stage after it, so the whole chain is
+one loop in the source with the stages inlined into its body
+
+a source pushes one argument per element, zip pushes two,
+transform and filter take as many arguments as are pushed to them
+*/
+
+template <typename V, typename F> class Transform_View;
+template <typename V, typename P> class Filter_View;
+template <typename V>             class Take_View;
+template <typename V>             class Stride_View;
+
+// ---------
+// View_Base
+// ---------
+
+template <typename D>
+class View_Base {
+    private:
+        template <typename T, typename BF>
+        struct Reduce_Sink {
+            T&  _v;
+            BF& _f;
+
+            Reduce_Sink (T& v, BF& f) :
+                    _v (v),
+                    _f (f)
+                {}
+
+            template <typename A>
+            bool operator () (const A& a) {
+                _v = _f(_v, a);
+                return true;}};
+
+        template <typename F>
+        struct For_Each_Sink {
+            F& _f;
+
+            explicit For_Each_Sink (F& f) :
+                    _f (f)
+                {}
+
+            template <typename... A>
+            bool operator () (const A&... a) {
+                _f(a...);
+                return true;}};
+
+        const D& derived () const {
+            return static_cast<const D&>(*this);}
+
+    public:
+        template <typename F>
+        Transform_View<D, F> transform (F f) const {
+            return Transform_View<D, F>(derived(), f);}
+
+        template <typename P>
+        Filter_View<D, P> filter (P p) const {
+            return Filter_View<D, P>(derived(), p);}
+
+        /**
+         * the first n elements
+         */
+        Take_View<D> take (std::ptrdiff_t n) const {
+            return Take_View<D>(derived(), n);}
+
+        /**
+         * every n-th element, starting with the first
+         */
+        Stride_View<D> stride (std::ptrdiff_t n) const {
+            return Stride_View<D>(derived(), n);}
+
+        template <typename T, typename BF>
+        T reduce (T v, BF f) const {
+            derived().each(Reduce_Sink<T, BF>(v, f));
+            return v;}
+
+        template <typename T>
+        T reduce (T v) const {
+            return reduce(v, std::plus<T>());}
+
+        template <typename F>
+        F for_each (F f) const {
+            derived().each(For_Each_Sink<F>(f));
+            return f;}};
+
+// -------------
+// Iterator_View
+// -------------
+
+template <typename II>
+class Iterator_View : public View_Base<Iterator_View<II>> {
+    private:
+        II _b;
+        II _e;
+
+    public:
+        Iterator_View (II b, II e) :
+                _b (b),
+                _e (e)
+            {}
+
+        template <typename G>
+        bool each (G g) const {
+            for (II b = _b; b != _e; ++b)
+                if (!g(*b))
+                    return false;
+            return true;}};
+
+// --------
+// Zip_View
+// --------
+
+template <typename II1, typename II2>
+class Zip_View : public View_Base<Zip_View<II1, II2>> {
+    private:
+        II1 _b;
+        II1 _e;
+        II2 _c;
+
+    public:
+        Zip_View (II1 b, II1 e, II2 c) :
+                _b (b),
+                _e (e),
+                _c (c)
+            {}
+
+        template <typename G>
+        bool each (G g) const {
+            II2 c = _c;
+            for (II1 b = _b; b != _e; ++b, ++c)
+                if (!g(*b, *c))
+                    return false;
+            return true;}};
+
+// --------------
+// Transform_View
+// --------------
+
+template <typename V, typename F>
+class Transform_View : public View_Base<Transform_View<V, F>> {
+    private:
+        template <typename G>
+        struct Sink {
+            const F& _f;
+            G        _g;
+
+            Sink (const F& f, G g) :
+                    _f (f),
+                    _g (g)
+                {}
+
+            template <typename... A>
+            bool operator () (const A&... a) {
+                return _g(_f(a...));}};
+
+        V _v;
+        F _f;
+
+    public:
+        Transform_View (const V& v, F f) :
+                _v (v),
+                _f (f)
+            {}
+
+        template <typename G>
+        bool each (G g) const {
+            return _v.each(Sink<G>(_f, g));}};
+
+// -----------
+// Filter_View
+// -----------
+
+template <typename V, typename P>
+class Filter_View : public View_Base<Filter_View<V, P>> {
+    private:
+        template <typename G>
+        struct Sink {
+            const P& _p;
+            G        _g;
+
+            Sink (const P& p, G g) :
+                    _p (p),
+                    _g (g)
+                {}
+
+            template <typename... A>
+            bool operator () (const A&... a) {
+                return !_p(a...) || _g(a...);}};
+
+        V _v;
+        P _p;
+
+    public:
+        Filter_View (const V& v, P p) :
+                _v (v),
+                _p (p)
+            {}
+
+        template <typename G>
+        bool each (G g) const {
+            return _v.each(Sink<G>(_p, g));}};
+
+// ---------
+// Take_View
+// ---------
+
+template <typename V>
+class Take_View : public View_Base<Take_View<V>> {
+    private:
+        template <typename G>
+        struct Sink {
+            std::ptrdiff_t _n;
+            G              _g;
+
+            Sink (std::ptrdiff_t n, G g) :
+                    _n (n),
+                    _g (g)
+                {}
+
+            template <typename... A>
+            bool operator () (const A&... a) {
+                return _g(a...) && (--_n != 0);}};
+
+        V              _v;
+        std::ptrdiff_t _n;
+
+    public:
+        Take_View (const V& v, std::ptrdiff_t n) :
+                _v (v),
+                _n (n)
+            {}
+
+        template <typename G>
+        bool each (G g) const {
+            return (_n <= 0) || _v.each(Sink<G>(_n, g));}};
+
+// -----------
+// Stride_View
+// -----------
+
+template <typename V>
+class Stride_View : public View_Base<Stride_View<V>> {
+    private:
+        template <typename G>
+        struct Sink {
+            std::ptrdiff_t _n;
+            std::ptrdiff_t _i;
+            G              _g;
+
+            Sink (std::ptrdiff_t n, G g) :
+                    _n (n),
+                    _i (0),
+                    _g (g)
+                {}
+
+            template <typename... A>
+            bool operator () (const A&... a) {
+                if (_i != 0) {
+                    _i = (_i + 1 == _n) ? 0 : _i + 1;
+                    return true;}
+                _i = (_n == 1) ? 0 : 1;
+                return _g(a...);}};
+
+        V              _v;
+        std::ptrdiff_t _n;
+
+    public:
+        /**
+         * n must be positive
+         */
+        Stride_View (const V& v, std::ptrdiff_t n) :
+                _v (v),
+                _n (n)
+            {}
+
+        template <typename G>
+        bool each (G g) const {
+            return _v.each(Sink<G>(_n, g));}};
+
+// ----
+// view
+// ----
+
+template <typename II>
+Iterator_View<II> view (II b, II e) {
+    return Iterator_View<II>(b, e);}
+
+/**
+ * x must outlive the view, a Range or a container
+ */
+template <typename C>
+auto view (const C& x) -> Iterator_View<decltype(x.begin())> {
+    return Iterator_View<decltype(x.begin())>(x.begin(), x.end());}
+
+// ---
+// zip
+// ---
+
+template <typename II1, typename II2>
+Zip_View<II1, II2> zip (II1 b, II1 e, II2 c) {
+    return Zip_View<II1, II2>(b, e, c);}
+
+#endif // View_h
@@ -20,6 +20,69 @@
 #include <cstring>   // memcpy
 #include <stdint.h>  // uint32_t
 #include <cstdlib>   // abs
+#include <cstdint>   // uint64_t, uintptr_t
+#include <random>    // random_device
+#include <vector>    // vector
+
+#include <boost/serialization/access.hpp>        // access
+#include <boost/serialization/binary_object.hpp> // make_binary_object
+#include <boost/serialization/split_member.hpp>  // BOOST_SERIALIZATION_SPLIT_MEMBER
+
+// ------------------
+// ALLOCATOR_HARDENED
+// ------------------
+
+/*
+define ALLOCATOR_HARDENED for a mode that is cheap enough for a release build
+each arena has a secret that is XORed into every footer, so an overwrite,
+or a pointer into the middle of a block, is very unlikely to leave a header that matches its footer
+the headers stay plain, so that the walk of allocate is the same as in the plain mode
+deallocate checks the block's own header and footer, and the ones of any neighbor it coalesces with,
+in O(1), instead of walking the arena, and a header that is already free is a double free
+a checkpoint holds the arena decoded, so it never gives the secret away,
+and it loads into an arena of either mode
+
+define ALLOCATOR_UNCHECKED for a deallocate that does not check p at all,
+the baseline that AllocatorBench.c++ measures the cost of the checks against
+*/
+
+// --------------
+// ALLOCATOR_COLD
+// --------------
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ALLOCATOR_COLD __attribute__((noinline, cold))
+#else
+#define ALLOCATOR_COLD
+#endif
+
+// ----------------
+// allocator_secret
+// ----------------
+
+/**
+ * O(1) in space
+ * O(1) in time
+ * a random int for the arena at p, from a random key for the process
+ */
+inline int allocator_secret (const void* p) {
+    static const std::uint64_t k = (static_cast<std::uint64_t>(std::random_device()()) << 32) ^ std::random_device()();
+    std::uint64_t x = reinterpret_cast<std::uintptr_t>(p) ^ k;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    x =  x ^ (x >> 31);
+    return static_cast<int>(x);}
+
+// -----------------
+// allocator_corrupt
+// -----------------
+
+/**
+ * throw an invalid_argument exception with s
+ * out of line and cold, so that the checks on the hot path stay a compare and a branch
+ */
+[[noreturn]] ALLOCATOR_COLD inline void allocator_corrupt (const char* s) {
+    throw std::invalid_argument(s);}
 
 // ---------
 // Allocator
@@ -67,6 +130,163 @@ class Allocator {
 
         char a[N];
 
+        #ifdef ALLOCATOR_HARDENED
+        int secret;
+        #endif
+
+        // ------
+        // header
+        // ------
+
+        /**
+         * O(1) in space
+         * O(1) in time
+         * read the header at i, plain in every mode
+         */
+        int header (const char* i) const {
+            int v;
+            memcpy(&v, i, sizeof(int));
+            return v;}
+
+        /**
+         * O(1) in space
+         * O(1) in time
+         * write the header v at i
+         */
+        void header (char* i, int v) {
+            memcpy(i, &v, sizeof(int));}
+
+        // ------
+        // footer
+        // ------
+
+        /**
+         * O(1) in space
+         * O(1) in time
+         * read the footer at i, decoded with the secret in hardened mode
+         */
+        int footer (const char* i) const {
+            int v;
+            memcpy(&v, i, sizeof(int));
+            return v ^ key();}
+
+        /**
+         * O(1) in space
+         * O(1) in time
+         * write the footer v at i, encoded with the secret in hardened mode
+         */
+        void footer (char* i, int v) {
+            v ^= key();
+            memcpy(i, &v, sizeof(int));}
+
+        // -----
+        // block
+        // -----
+
+        /**
+         * O(1) in space
+         * O(1) in time
+         * write the header and the footer of the block of v at i
+         */
+        void block (char* i, int v) {
+            header(i, v);
+            footer(i + sizeof(int) + abs(v), v);}
+
+        // ---
+        // key
+        // ---
+
+        /**
+         * O(1) in space
+         * O(1) in time
+         * the secret that the footers are encoded with, 0 if the mode is not hardened
+         */
+        int key () const {
+            #ifdef ALLOCATOR_HARDENED
+            return secret;
+            #else
+            return 0;
+            #endif
+            }
+
+        // -----
+        // check
+        // -----
+
+        /**
+         * O(1) in space
+         * O(1) in time
+         * the size of the allocated block at p, if its header matches its footer
+         * one decode, and a compare and a branch for each of p, the size, and the footer,
+         * the bounds are unsigned, so that one compare covers both of their ends
+         * anything else goes to reject, out of line
+         */
+        int check (const char* p) const {
+            const size_t o = reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(a + sizeof(int));
+            if (o >= N - 2 * sizeof(int))
+                reject(p);
+            const int    h = header(p - sizeof(int));
+            const size_t s = 0u - static_cast<size_t>(h);                // -h, huge for a free header
+            if (s - 1 >= N - 2 * sizeof(int) - o)
+                reject(p);
+            if (footer(p + s) != h)
+                reject(p);
+            return static_cast<int>(s);}
+
+        // ------
+        // reject
+        // ------
+
+        /**
+         * O(1) in space
+         * O(1) in time
+         * throw an invalid_argument exception that says why p did not pass check
+         */
+        [[noreturn]] ALLOCATOR_COLD void reject (const char* p) const {
+            const size_t o = reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(a + sizeof(int));
+            if (o >= N - 2 * sizeof(int))
+                allocator_corrupt("p is not in the arena");
+            const int h = header(p - sizeof(int));
+            if ((h > 0) && (static_cast<size_t>(h) <= N - 2 * sizeof(int) - o) && (footer(p + h) == h))
+                allocator_corrupt("double free");
+            allocator_corrupt("corrupt sentinel");}
+
+        // ------
+        // recode
+        // ------
+
+        /**
+         * O(1) in space
+         * O(N) in time
+         * XOR the footers of the arena at b with k
+         * false, if its headers do not tile the arena, and then b is left half done
+         */
+        static bool recode (char* b, int k) {
+            for (char* i = b; i != b + N;) {
+                int h;
+                memcpy(&h, i, sizeof(int));
+                const ptrdiff_t s = (h < 0) ? -static_cast<ptrdiff_t>(h) : static_cast<ptrdiff_t>(h);
+                if ((s == 0) || (s > (b + N - i) - static_cast<ptrdiff_t>(2 * sizeof(int))))
+                    return false;
+                int f;
+                memcpy(&f, i + sizeof(int) + s, sizeof(int));
+                f ^= k;
+                memcpy(i + sizeof(int) + s, &f, sizeof(int));
+                i += s + 2 * sizeof(int);}
+            return true;}
+
+        // -----
+        // reset
+        // -----
+
+        /**
+         * O(1) in space
+         * O(1) in time
+         * one free block over the whole arena
+         */
+        void reset () {
+            block(a, N - 2 * sizeof(int));}
+
         // -----
         // valid
         // -----
@@ -80,20 +300,21 @@ class Allocator {
             bool can_be_free = true;
             for(const char* i = a; i < &a[N-sizeof(int)];)
             {
-                int diff = abs(*(int*)i) + sizeof(int);
+                const int s = header(i);
+                int diff = abs(s) + sizeof(int);
 
-                if (*(int*)i != *(int*)(i+diff))    //Does the sentinel have a matching
+                if (s != footer(i+diff))          //Does the sentinel have a matching
                                                     //sentinel at the appropriate address?
                     return false;
 
                 diff += sizeof(int);
-                if(*(int*)i > 0)                    //If the block is free:
+                if(s > 0)                           //If the block is free:
                 {
                     if(!can_be_free)                    //Is it ok for the block to be free?
                     {                                   //i.e. was the last block occupied?
                         return false;                   //Otherwise we have two consecutive free blocks
                     }
-                    if(*(int*)i < sizeof(T))            //Is the block big enough to fit a T?
+                    if(s < (int)sizeof(T))              //Is the block big enough to fit a T?
                     {                                   //If not we are wasting space
                         return false;
                     }
@@ -135,12 +356,59 @@ class Allocator {
         FRIEND_TEST(TestAllocator2, constructor_3);
         FRIEND_TEST(TestAllocator2, allocate_2);
         FRIEND_TEST(TestAllocator2, allocate_3);
+        FRIEND_TEST(TestAllocator2, allocate_4);
         FRIEND_TEST(TestAllocator2, deallocate_1);
         FRIEND_TEST(TestAllocator2, deallocate_2);
         #endif
         int& operator [] (int i) {
             return *reinterpret_cast<int*>(&a[i]);}
 
+        // ---------
+        // serialize
+        // ---------
+
+        friend class boost::serialization::access;
+
+        /**
+         * O(1) in space, O(N) in hardened mode
+         * O(N) in time
+         * N, then the arena as one binary blob, not block by block,
+         * so that a checkpoint moves at the bandwidth of the archive's stream
+         * in hardened mode, the blob is a decoded copy, so that the secret stays in memory
+         */
+        template <typename A>
+        void save (A& ar, const unsigned int) const {
+            const size_t n = N;
+            ar << n;
+            #ifdef ALLOCATOR_HARDENED
+            vector<char> b(a, a + N);
+            recode(b.data(), secret);
+            ar << boost::serialization::make_binary_object(b.data(), N);
+            #else
+            ar << boost::serialization::make_binary_object(const_cast<char*>(a), N);
+            #endif
+            }
+
+        /**
+         * O(1) in space
+         * O(N) in time
+         * the arena, encoded again with this arena's own secret in hardened mode
+         * throw an invalid_argument exception, if the archive is of a different N,
+         * or if its blocks are not valid, and then the arena is left as constructed
+         */
+        template <typename A>
+        void load (A& ar, const unsigned int) {
+            size_t n;
+            ar >> n;
+            if (n != N)
+                throw invalid_argument("N");
+            ar >> boost::serialization::make_binary_object(a, N);
+            if (!recode(a, key()) || !valid()) {
+                reset();
+                throw invalid_argument("arena");}}
+
+        BOOST_SERIALIZATION_SPLIT_MEMBER()
+
     public:
         // ------------
         // constructors
@@ -151,15 +419,18 @@ class Allocator {
          * O(1) in time
          * throw a bad_alloc exception, if N is less than sizeof(T) + (2 * sizeof(int))
          */
+        #ifdef ALLOCATOR_HARDENED
+        Allocator () :
+                secret (allocator_secret(this)) {
+        #else
         Allocator () {
+        #endif
             if(N < sizeof(T) + (2 * sizeof(int)))
             {
                 throw bad_alloc();
             }
 
-            int avail = N-2*sizeof(int);
-            write_sentinel_to_arr(a, &avail);
-            write_sentinel_to_arr(&a[N-sizeof(int)], &avail);
+            reset();
 
             assert(valid());}
 
@@ -188,28 +459,24 @@ class Allocator {
             }
             for(char* i = a; i < a+N;)  //iterate over blocks
             {
-                if(*(int*)i >= n && *(int*)i > 0)   //If we have a free block with enough space
+                const int old = header(i);
+                if(old > 0 && (size_type)old >= n)  //If we have a free block with enough space
                 {
-                    if(*((int*)i)-(n+2*sizeof(int)) >= sizeof(T) + 2*sizeof(int))
+                    if((size_type)old >= n + 2*sizeof(int) + sizeof(T) + 2*sizeof(int))
                     {
-                        int old = *(int*)i;
-                        *(int*)i = -1*n;
-                        *(int*)(i+sizeof(int)+n) = -1*n;
-                        *(int*)(i+2*sizeof(int)+n) = old-n-2*sizeof(int);
-                        *(int*)(i+old+sizeof(int)) = old-n-2*sizeof(int);
+                        block(i,                 -1*(int)n);
+                        block(i+2*sizeof(int)+n, old-n-2*sizeof(int));
                     }
                     else
                     {
-                        int old = *(int*)i;
-                        *(int*)i = -1*old;
-                        *(int*)(i+sizeof(int)+old) = -1*old;
+                        block(i, -1*old);
                     }
 
                     assert(valid());
 
                     return (pointer)(i+sizeof(int));
                 }
-                i += 2*sizeof(int) + abs(*((int*)i));
+                i += 2*sizeof(int) + abs(old);
             }
             throw bad_alloc();
         }
@@ -232,43 +499,61 @@ class Allocator {
 
         /**
          * O(1) in space
-         * O(1) in time
+         * O(n) in time, O(1) in hardened mode
          * after deallocation adjacent free blocks must be coalesced
          * throw an invalid_argument exception, if p is invalid
-         * <your documentation>
+         * in hardened mode, p is checked against its own header and footer, not by a walk,
+         * a neighbor is checked before it is coalesced, and a free header is a double free
          */
         void deallocate (pointer p, size_type) {
-            char* pc = (char*) p;
+            char* b = (char*)p - sizeof(int);              //the header of the block
+            #if defined(ALLOCATOR_HARDENED)
+            const int own = check((char*)p);
+            #else
+            #if !defined(ALLOCATOR_UNCHECKED)
             if(!pointer_valid(p))
             {
                 throw invalid_argument("pc");
             }
-            int size = -1*(*(int*)(pc-sizeof(int)));
-            *(int*)(pc-sizeof(int)) = size;
-            pc += size;
-            *(int*)pc = size;
-            pc -= size + 2*sizeof(int);
-            if(*(int*)pc > 0 && pc >= a)
+            #endif
+            const int own = -1*header(b);
+            #endif
+            int size = own;
+
+            if(b > a)                                      //coalesce with the block before
             {
-                int sum = *(int*)pc + size + 2*sizeof(int);
-                pc -= sum-size-sizeof(int);
-                *(int*)pc = sum;
-                pc += sum+sizeof(int);
-                *(int*)pc = sum;
-                size = sum;
-                pc -= size + 2*sizeof(int);
+                const int before = footer(b-sizeof(int));
+                if(before > 0)
+                {
+                    #ifdef ALLOCATOR_HARDENED
+                    if(before > b - a - (int)(2*sizeof(int)) || header(b - 2*sizeof(int) - before) != before)
+                    {
+                        allocator_corrupt("corrupt sentinel");
+                    }
+                    #endif
+                    size += before + 2*sizeof(int);
+                    b -= before + 2*sizeof(int);
+                }
             }
 
-            pc += size + 3*sizeof(int);
-            if(*(int*)pc > 0 && pc < a+N)
+            char* const c = b + size + 2*sizeof(int);      //coalesce with the block after
+            if(c < a+N)
             {
-                int sum = *(int*)pc + size + 2*sizeof(int);
-                pc += sum-size-sizeof(int);
-                *(int*)pc = sum;
-                pc -= sum+sizeof(int);
-                *(int*)pc = sum;
-                pc -= size + 2*sizeof(int);
-            }            
+                const int after = header(c);
+                if(after > 0)
+                {
+                    #ifdef ALLOCATOR_HARDENED
+                    if(after > (a+N) - c - (int)(2*sizeof(int)) || footer(c+sizeof(int)+after) != after)
+                    {
+                        allocator_corrupt("corrupt sentinel");
+                    }
+                    #endif
+                    size += after + 2*sizeof(int);
+                }
+            }
+
+            block((char*)p-sizeof(int), own);              //its own header and footer are free too,
+            block(b, size);                                //so that a second free of p is seen
 
             assert(valid());}
 
@@ -276,7 +561,7 @@ class Allocator {
         {
             for(char* i = a; i < a+N;)
             {
-                int size = abs(*(int*)i);
+                int size = abs(header(i));
                 i += sizeof(int);
                 if(i == (char*)p)
                     return true;
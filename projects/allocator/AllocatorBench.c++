@@ -0,0 +1,103 @@
+// -------------------------------------
+// projects/allocator/AllocatorBench.c++
+// -------------------------------------
+
+// built three times, plain, with ALLOCATOR_UNCHECKED, and with ALLOCATOR_HARDENED, at -O3 -DNDEBUG, see the makefile
+// the unchecked build is the baseline of the hardened one, it differs only in that deallocate does not check p
+
+#include <algorithm> // fill, min
+#include <chrono>    // duration, steady_clock
+#include <cstdio>    // printf, remove
+#include <fstream>   // ifstream, ofstream
+#include <memory>    // unique_ptr
+#include <vector>    // vector
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include "Allocator.h"
+
+typedef Allocator<int, (1 << 16)> allocator_type;
+
+// the best of r runs of f, in ns per allocate/deallocate pair
+template <typename F>
+double best (int r, int k, F f) {
+    double t = 1e30;
+    for (int i = 0; i != r; ++i) {
+        const std::chrono::steady_clock::time_point b = std::chrono::steady_clock::now();
+        f();
+        const std::chrono::steady_clock::time_point e = std::chrono::steady_clock::now();
+        t = std::min(t, std::chrono::duration<double, std::nano>(e - b).count() / k);}
+    return t;}
+
+int main () {
+    using namespace std;
+    const int                       m = 200;  // rounds
+    const int                       n = 64;   // live blocks
+    unique_ptr<allocator_type>      x(new allocator_type);
+    vector<int*>                    p(n);
+    volatile int                    s = 0;
+
+    // one block, allocated and freed at the front of the arena
+    const double t1 = best(5, m * n, [&] () {
+        for (int i = 0; i != m * n; ++i) {
+            int* const q = x->allocate(4);
+            s = s + *q;
+            x->deallocate(q, 4);}});
+
+    // n small blocks, freed last in first out
+    const double t2 = best(5, m * n, [&] () {
+        for (int j = 0; j != m; ++j) {
+            for (int i = 0; i != n; ++i)
+                p[i] = x->allocate(1 + i % 7);
+            for (int i = n; i != 0; --i)
+                x->deallocate(p[i - 1], 0);}});
+
+    // n small blocks, every other one freed first, then the rest, so each free coalesces
+    const double t3 = best(5, m * n, [&] () {
+        for (int j = 0; j != m; ++j) {
+            for (int i = 0; i != n; ++i)
+                p[i] = x->allocate(1 + i % 7);
+            for (int i = 0; i < n; i += 2)
+                x->deallocate(p[i], 0);
+            for (int i = 1; i < n; i += 2)
+                x->deallocate(p[i], 0);}});
+
+    #if defined(ALLOCATOR_HARDENED)
+    printf("hardened, ns per allocate/deallocate pair\n");
+    #elif defined(ALLOCATOR_UNCHECKED)
+    printf("unchecked, ns per allocate/deallocate pair\n");
+    #else
+    printf("plain, ns per allocate/deallocate pair\n");
+    #endif
+    printf("%-12s %10.1f\n", "front",       t1);
+    printf("%-12s %10.1f\n", "lifo",        t2);
+    printf("%-12s %10.1f\n", "interleaved", t3);
+
+    // a checkpoint of a 64 MB arena, saved to and loaded from a file
+    {
+    typedef Allocator<char, (1 << 26)> arena_type;
+    const char* const           f = "AllocatorBench.bin";
+    unique_ptr<arena_type>      a(new arena_type);
+    unique_ptr<arena_type>      c(new arena_type);
+    char* const                 q = a->allocate(1 << 25);
+    fill(q, q + (1 << 25), 'a');
+    const chrono::steady_clock::time_point b = chrono::steady_clock::now();
+    {
+    ofstream                        out(f, ios::binary);
+    boost::archive::binary_oarchive o(out);
+    o << *a;
+    }
+    const chrono::steady_clock::time_point m = chrono::steady_clock::now();
+    {
+    ifstream                        in(f, ios::binary);
+    boost::archive::binary_iarchive i(in);
+    i >> *c;
+    }
+    const chrono::steady_clock::time_point e = chrono::steady_clock::now();
+    remove(f);
+    printf("\ncheckpoint of %d MB\n", (1 << 26) >> 20);
+    printf("%-12s %10.1f MB/s\n", "save", (1 << 26) / 1e6 / chrono::duration<double>(m - b).count());
+    printf("%-12s %10.1f MB/s\n", "load", (1 << 26) / 1e6 / chrono::duration<double>(e - m).count());
+    }
+    return 0;}
@@ -11,7 +11,18 @@
 #define ISTEST 1
 
 #include <algorithm> // count
+#include <cstdio>    // remove
+#include <cstdlib>   // mkstemp
+#include <fstream>   // ifstream, ofstream
 #include <memory>    // allocator
+#include <sstream>   // stringstream
+#include <stdexcept> // invalid_argument
+#include <string>    // string
+
+#include <unistd.h>  // close
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 
 #include "gtest/gtest.h"
 
@@ -91,6 +102,9 @@ TYPED_TEST(TestAllocator1, test_10) {
 // TestAllocator2
 // --------------
 
+// these read and write the raw sentinels, which are encoded in hardened mode
+#ifndef ALLOCATOR_HARDENED
+
 TEST(TestAllocator2, const_index) {
     const Allocator<int, 100> x;
     ASSERT_EQ(x[0], 92);}
@@ -281,6 +295,15 @@ TEST(TestAllocator2, allocate_3)
     ASSERT_TRUE(true);
 }
 
+TEST(TestAllocator2, allocate_4)
+{
+    Allocator<int, 100> a;
+    a.allocate(22);                     // 88 of 92 bytes, too few left for a free block
+    ASSERT_EQ(*(int*)(a.a), -92);
+    ASSERT_EQ(*(int*)(a.a + 96), -92);
+    ASSERT_TRUE(a.valid());
+}
+
 // ----------
 // deallocate
 // ----------
@@ -345,6 +368,8 @@ TEST(TestAllocator2, pointer_valid_3)
     ASSERT_TRUE(a.pointer_valid(p));
 }
 
+#endif // ALLOCATOR_HARDENED
+
 // --------------
 // TestAllocator3
 // --------------
@@ -411,3 +436,175 @@ TYPED_TEST(TestAllocator3, test_10) {
             --e;
             x.destroy(e);}
         x.deallocate(b, s);}}
+
+// --------------
+// TestAllocator4
+// --------------
+
+template <typename A>
+const char* arena (const A& x) {
+    return reinterpret_cast<const char*>(&x[0]);}
+
+TEST(TestAllocator4, serialize_1) {
+    Allocator<double, 100> x;
+    double* p = x.allocate(2);
+    double* q = x.allocate(3);
+    x.construct(p, 2.5);
+    x.construct(q, 3.5);
+    x.deallocate(p, 2);
+    std::stringstream s;
+    {
+    boost::archive::binary_oarchive o(s);
+    o << x;
+    }
+    Allocator<double, 100> y;
+    {
+    boost::archive::binary_iarchive i(s);
+    i >> y;
+    }
+    #ifndef ALLOCATOR_HARDENED
+    ASSERT_TRUE(std::equal(arena(x), arena(x) + 100, arena(y)));
+    #endif
+    double* const r = reinterpret_cast<double*>(const_cast<char*>(arena(y)) + (reinterpret_cast<char*>(q) - arena(x)));
+    ASSERT_EQ(3.5, *r);
+    y.deallocate(r, 3);
+    ASSERT_NE(nullptr, y.allocate(11));}
+
+TEST(TestAllocator4, serialize_2) {
+    Allocator<int, 100> x;
+    std::stringstream s;
+    {
+    boost::archive::binary_oarchive o(s);
+    o << x;
+    }
+    Allocator<int, 200> y;
+    boost::archive::binary_iarchive i(s);
+    ASSERT_THROW(i >> y, std::invalid_argument);}
+
+struct TestAllocator4File : ::testing::Test {
+    std::string f;
+
+    TestAllocator4File () :
+            f ()
+        {}
+
+    // a fresh file of its own, so that runs do not collide
+    void SetUp () override {
+        char p[] = "/tmp/TestAllocator.XXXXXX";
+        const int d = mkstemp(p);
+        ASSERT_NE(-1, d);
+        close(d);
+        f = p;}
+
+    void TearDown () override {
+        std::remove(f.c_str());}};
+
+TEST_F(TestAllocator4File, serialize_3) {
+    typedef Allocator<char, (1 << 12)> allocator_type;
+    allocator_type x;
+    allocator_type y;
+    char* const p = x.allocate(1 << 11);
+    std::fill(p, p + (1 << 11), 'a');
+    {
+    std::ofstream                   out(f, std::ios::binary);
+    boost::archive::binary_oarchive o(out);
+    o << x;
+    }
+    {
+    std::ifstream                   in(f, std::ios::binary);
+    boost::archive::binary_iarchive i(in);
+    i >> y;
+    }
+    ASSERT_TRUE(std::equal(arena(x), arena(x) + sizeof(int), arena(y)));
+    ASSERT_TRUE(std::equal(p, p + (1 << 11), arena(y) + (p - arena(x))));}
+
+TEST(TestAllocator4, serialize_4) {
+    Allocator<int, 100> x;
+    x.allocate(4);
+    std::stringstream s;
+    {
+    boost::archive::binary_oarchive o(s);
+    o << x;
+    }
+    std::string b = s.str();
+    b[b.size() - 100 + 1] = 0x7f;                // the header of the first block
+    std::stringstream t(b);
+    Allocator<int, 100> y;
+    y.allocate(4);
+    boost::archive::binary_iarchive i(t);
+    ASSERT_THROW(i >> y, std::invalid_argument);
+    ASSERT_EQ(92, *reinterpret_cast<const int*>(arena(y)));
+    ASSERT_NE(nullptr, y.allocate(23));}
+
+TEST(TestAllocator4, serialize_5) {
+    const Allocator<int, 100> x;
+    std::stringstream s;
+    {
+    boost::archive::binary_oarchive o(s);
+    o << x;
+    }
+    const std::string b = s.str();
+    int f;
+    std::copy(b.end() - 4, b.end(), reinterpret_cast<char*>(&f));
+    ASSERT_EQ(92, f);}                           // decoded, in every mode
+
+// --------------
+// TestAllocator5
+// --------------
+
+#ifdef ALLOCATOR_HARDENED
+
+TEST(TestAllocator5, hardened_1) {
+    const Allocator<int, 100> x;
+    ASSERT_EQ(92, x[0]);                         // the header is plain
+    ASSERT_NE(92, x[96]);}                       // the footer is not
+
+TEST(TestAllocator5, hardened_2) {
+    Allocator<int, 100> x;
+    int* p = x.allocate(4);
+    int* q = x.allocate(4);
+    x.deallocate(p, 4);
+    ASSERT_THROW(x.deallocate(p, 4), std::invalid_argument);
+    x.deallocate(q, 4);
+    ASSERT_THROW(x.deallocate(q, 4), std::invalid_argument);
+    ASSERT_NE(nullptr, x.allocate(23));}
+
+TEST(TestAllocator5, hardened_3) {
+    Allocator<int, 100> x;
+    int* p = x.allocate(4);
+    p[-1] = 16;
+    ASSERT_THROW(x.deallocate(p, 4), std::invalid_argument);}
+
+TEST(TestAllocator5, hardened_4) {
+    Allocator<int, 100> x;
+    int* p = x.allocate(4);
+    p[4] = -16;
+    ASSERT_THROW(x.deallocate(p, 4), std::invalid_argument);}
+
+TEST(TestAllocator5, hardened_5) {
+    Allocator<int, 100> x;
+    int  i = 0;
+    int* p = x.allocate(4);
+    ASSERT_THROW(x.deallocate(p + 1, 4), std::invalid_argument);
+    ASSERT_THROW(x.deallocate(&i,    1), std::invalid_argument);
+    x.deallocate(p, 4);}
+
+TEST(TestAllocator5, hardened_6) {
+    Allocator<int, 100> x;
+    int* p = x.allocate(4);
+    int* q = x.allocate(4);
+    x.deallocate(p, 4);
+    p[-1] = 0;                                   // the header of the free block before q
+    ASSERT_THROW(x.deallocate(q, 4), std::invalid_argument);}
+
+TEST(TestAllocator5, hardened_7) {
+    Allocator<int, 100> x;
+    int* p = x.allocate(4);
+    int* q = x.allocate(4);
+    int* r = x.allocate(4);
+    x.deallocate(p, 4);
+    x.deallocate(r, 4);
+    x.deallocate(q, 4);
+    ASSERT_EQ(p, x.allocate(23));}
+
+#endif // ALLOCATOR_HARDENED
@@ -9,6 +9,7 @@
 // --------
 
 #include <cassert>  // assert
+#include <cstdint>  // uint64_t
 #include <iostream> // endl, istream, ostream
 
 #include "Collatz.h"
@@ -50,3 +51,35 @@ void collatz_solve (istream& r, ostream& w) {
     while (collatz_read(r, i, j)) {
         const int v = collatz_eval(i, j);
         collatz_print(w, i, j, v);}}
+
+// -------------
+// Collatz_Cache
+// -------------
+
+Collatz_Cache::Collatz_Cache (int n) :
+        _a (n, 0) {
+    assert(n > 0);}
+
+int Collatz_Cache::cycle_length (int n) {
+    assert(n > 0);
+    const int s = size();
+    uint64_t  m = n;
+    int       c = 0;
+    while ((m != 1) && !((m < static_cast<uint64_t>(s)) && (_a[m] != 0))) {
+        m = (m % 2) ? (3 * m + 1) : (m / 2);
+        ++c;}
+    c += (m == 1) ? 1 : _a[m];
+    if (n < s)
+        _a[n] = c;
+    return c;}
+
+int Collatz_Cache::cached (int n) const {
+    assert(n > 0);
+    return (n < size()) ? _a[n] : 0;}
+
+void Collatz_Cache::fill () {
+    for (int i = 1; i < size(); ++i)
+        cycle_length(i);}
+
+int Collatz_Cache::size () const {
+    return static_cast<int>(_a.size());}
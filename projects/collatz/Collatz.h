@@ -11,9 +11,17 @@
 // includes
 // --------
 
-#include <iostream> // istream, ostream
-#include <string>   // string
-#include <utility>  // pair
+#include <cstdint>   // uint64_t
+#include <iostream>  // istream, ostream
+#include <limits>    // numeric_limits
+#include <stdexcept> // invalid_argument
+#include <string>    // string
+#include <utility>   // pair
+#include <vector>    // vector
+
+#include <boost/serialization/access.hpp>        // access
+#include <boost/serialization/binary_object.hpp> // make_binary_object
+#include <boost/serialization/split_member.hpp>  // BOOST_SERIALIZATION_SPLIT_MEMBER
 
 using namespace std;
 
@@ -64,4 +72,65 @@ void collatz_print (ostream& w, int i, int j, int v);
  */
 void collatz_solve (istream& r, ostream& w);
 
+// -------------
+// Collatz_Cache
+// -------------
+
+/**
+ * the cycle lengths of [1, n), each computed the first time it is asked for
+ * serialized as its size, then its lengths as one binary blob, not one by one,
+ * so that a checkpoint moves at the bandwidth of the archive's stream
+ * a load of a size that is 0 or not an int throws invalid_argument, and leaves the cache as it was
+ */
+class Collatz_Cache {
+    friend class boost::serialization::access;
+
+    private:
+        vector<int> _a; // 0 for not computed yet
+
+        template <typename A>
+        void save (A& ar, const unsigned int) const {
+            const uint64_t n = _a.size();
+            ar << n;
+            ar << boost::serialization::make_binary_object(const_cast<int*>(_a.data()), n * sizeof(int));}
+
+        template <typename A>
+        void load (A& ar, const unsigned int) {
+            uint64_t n;
+            ar >> n;
+            if ((n == 0) || (n > static_cast<uint64_t>(numeric_limits<int>::max())))
+                throw invalid_argument("Collatz_Cache");
+            _a.assign(n, 0);
+            ar >> boost::serialization::make_binary_object(_a.data(), n * sizeof(int));}
+
+        BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+    public:
+        /**
+         * @param n one past the largest cached value
+         */
+        explicit Collatz_Cache (int n = 1000000);
+
+        /**
+         * @param n a positive int
+         * @return the cycle length of n, which is cached if n is in range
+         */
+        int cycle_length (int n);
+
+        /**
+         * @param n a positive int
+         * @return the cached cycle length of n, 0 if it is not cached
+         */
+        int cached (int n) const;
+
+        /**
+         * compute and cache the cycle length of every value in range
+         */
+        void fill ();
+
+        /**
+         * @return one past the largest cached value
+         */
+        int size () const;};
+
 #endif // Collatz_h
@@ -0,0 +1,44 @@
+// ----------------------------------
+// projects/collatz/CollatzBench.c++
+// ----------------------------------
+
+// the bandwidth of a Collatz_Cache checkpoint, saved to and loaded from a file
+
+#include <chrono>   // duration, steady_clock
+#include <cstdio>   // printf, remove
+#include <cstdlib>  // atoi
+#include <fstream>  // ifstream, ofstream
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include "Collatz.h"
+
+int main (int argc, char* argv[]) {
+    using namespace std;
+    const int         n = (argc > 1) ? atoi(argv[1]) : (1 << 24);
+    const char* const f = "CollatzBench.bin";
+    Collatz_Cache     x(n);
+    Collatz_Cache     y(1);
+    x.fill();
+
+    const chrono::steady_clock::time_point b = chrono::steady_clock::now();
+    {
+    ofstream                        out(f, ios::binary);
+    boost::archive::binary_oarchive o(out);
+    o << x;
+    }
+    const chrono::steady_clock::time_point m = chrono::steady_clock::now();
+    {
+    ifstream                        in(f, ios::binary);
+    boost::archive::binary_iarchive i(in);
+    i >> y;
+    }
+    const chrono::steady_clock::time_point e = chrono::steady_clock::now();
+    remove(f);
+
+    const double s = (static_cast<double>(n) * sizeof(int)) / 1e6;
+    printf("%d cycle lengths, %.1f MB\n", n, s);
+    printf("%-6s %10.1f MB/s\n", "save", s / chrono::duration<double>(m - b).count());
+    printf("%-6s %10.1f MB/s\n", "load", s / chrono::duration<double>(e - m).count());
+    return (y.cached(n - 1) == x.cached(n - 1)) ? 0 : 1;}
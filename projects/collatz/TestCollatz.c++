@@ -10,10 +10,19 @@
 // includes
 // --------
 
+#include <cstdio>   // remove
+#include <cstdlib>  // mkstemp
+#include <fstream>  // ifstream, ofstream
 #include <iostream> // cout, endl
-#include <sstream>  // istringtstream, ostringstream
+#include <sstream>  // istringtstream, ostringstream, stringstream
+#include <stdexcept> // invalid_argument
 #include <string>   // string
 
+#include <unistd.h> // close
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
 #include "gtest/gtest.h"
 
 #include "Collatz.h"
@@ -71,3 +80,109 @@ TEST(CollatzFixture, solve) {
     ostringstream w;
     collatz_solve(r, w);
     ASSERT_EQ("1 10 1\n100 200 1\n201 210 1\n900 1000 1\n", w.str());}
+
+// -----
+// cache
+// -----
+
+TEST(CollatzFixture, cache_1) {
+    Collatz_Cache x(100);
+    ASSERT_EQ(  0, x.cached(9));
+    ASSERT_EQ(  1, x.cycle_length(1));
+    ASSERT_EQ( 20, x.cycle_length(9));
+    ASSERT_EQ( 20, x.cached(9));
+    ASSERT_EQ(112, x.cycle_length(27));
+    ASSERT_EQ(  0, x.cached(100));}
+
+TEST(CollatzFixture, cache_2) {
+    Collatz_Cache x(10);
+    ASSERT_EQ(112, x.cycle_length(27));
+    ASSERT_EQ(  0, x.cached(27));
+    ASSERT_EQ(351, x.cycle_length(77031));}
+
+TEST(CollatzFixture, cache_3) {
+    Collatz_Cache x(1000);
+    x.fill();
+    stringstream s;
+    {
+    boost::archive::binary_oarchive o(s);
+    o << x;
+    }
+    Collatz_Cache y(1);
+    {
+    boost::archive::binary_iarchive i(s);
+    i >> y;
+    }
+    ASSERT_EQ(1000, y.size());
+    for (int i = 1; i != 1000; ++i)
+        ASSERT_EQ(x.cached(i), y.cached(i));
+    ASSERT_EQ(179, y.cached(871));}
+
+TEST(CollatzFixture, cache_5) {
+    Collatz_Cache x(10);
+    x.fill();
+    stringstream s;
+    {
+    boost::archive::binary_oarchive o(s);
+    o << x;
+    }
+    const string b = s.str();
+    for (uint64_t n : {uint64_t(0), uint64_t(1) << 40}) {
+        string c = b;
+        c.replace(c.size() - 10 * sizeof(int) - sizeof(uint64_t), sizeof(uint64_t), reinterpret_cast<const char*>(&n), sizeof(uint64_t));
+        istringstream                   t(c);
+        boost::archive::binary_iarchive i(t);
+        Collatz_Cache                   y(5);
+        ASSERT_THROW(i >> y, invalid_argument);
+        ASSERT_EQ(5, y.size());}}
+
+TEST(CollatzFixture, cache_6) {
+    Collatz_Cache x(10);
+    x.fill();
+    stringstream s;
+    {
+    boost::archive::binary_oarchive o(s);
+    o << x;
+    }
+    const string                    b = s.str();
+    istringstream                   t(b.substr(0, b.size() - 1));
+    boost::archive::binary_iarchive i(t);
+    Collatz_Cache                   y(5);
+    ASSERT_THROW(i >> y, boost::archive::archive_exception);}
+
+struct CollatzCacheFixture : ::testing::Test {
+    string f;
+
+    CollatzCacheFixture () :
+            f ()
+        {}
+
+    // a fresh file of its own, so that runs do not collide
+    void SetUp () override {
+        char p[] = "/tmp/TestCollatz.XXXXXX";
+        const int d = mkstemp(p);
+        ASSERT_NE(-1, d);
+        close(d);
+        f = p;}
+
+    void TearDown () override {
+        remove(f.c_str());}};
+
+TEST_F(CollatzCacheFixture, cache_4) {
+    const int     n = 1 << 12;
+    Collatz_Cache x(n);
+    x.fill();
+    {
+    ofstream                        out(f, ios::binary);
+    boost::archive::binary_oarchive o(out);
+    o << x;
+    }
+    Collatz_Cache y(1);
+    {
+    ifstream                        in(f, ios::binary);
+    boost::archive::binary_iarchive i(in);
+    i >> y;
+    }
+    ASSERT_EQ(n, y.size());
+    for (int i = 1; i != n; ++i)
+        ASSERT_EQ(x.cached(i), y.cached(i));}